@@ -25,6 +25,7 @@
 #include "Aether/horizon/progress/RoundProgressBar.hpp"
 #include "Aether/horizon/Tick.hpp"
 #include "Aether/primary/Animation.hpp"
+#include "Aether/primary/Canvas.hpp"
 #include "Aether/primary/Ellipse.hpp"
 #include "Aether/primary/Image.hpp"
 #include "Aether/ThreadPool.hpp"
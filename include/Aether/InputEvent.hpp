@@ -30,13 +30,13 @@ namespace Aether {
             Button button_;
             /** @brief ID of the event */
             int id_;
-            /** @brief Horizontal touch position for touch events (Min = 0, Max = 1280) */
+            /** @brief Horizontal touch position for touch events (Min = 0, Max = window width) */
             int touchX_;
-            /** @brief Vertical touch position for touch events (Min = 0, Max = 720) */
+            /** @brief Vertical touch position for touch events (Min = 0, Max = window height) */
             int touchY_;
-            /** @brief Change in horizonal touch position for touch move events (Min = 0, Max = 1280) */
+            /** @brief Change in horizonal touch position for touch move events (Min = 0, Max = window width) */
             int touchDX_;
-            /** @brief Change in vertical touch position for touch move events (Min = 0, Max = 720) */
+            /** @brief Change in vertical touch position for touch move events (Min = 0, Max = window height) */
             int touchDY_;
 
         public:
@@ -44,8 +44,10 @@ namespace Aether {
              * @brief Construct a new Input Event object from a SDL_Event
              *
              * @param event SDL_Event to make InputEvent from
+             * @param width Logical width of the window that touch positions are mapped onto
+             * @param height Logical height of the window that touch positions are mapped onto
              */
-            InputEvent(SDL_Event event);
+            InputEvent(SDL_Event event, const unsigned int width = 1280, const unsigned int height = 720);
 
             /**
              * @brief Getter function to get event type
@@ -0,0 +1,46 @@
+#ifndef AETHER_RENDERER_CAPTUREJOB_HPP
+#define AETHER_RENDERER_CAPTUREJOB_HPP
+
+#include "Aether/Renderer.hpp"
+#include "Aether/ThreadPool.Job.hpp"
+
+namespace Aether {
+    /**
+     * @brief Extends a thread pool job to write a captured frame to disk
+     * on a separate thread.
+     */
+    class Renderer::CaptureJob : public ThreadPool::Job {
+        private:
+            Renderer * renderer;                /** @brief Renderer which captured the frame */
+            std::vector<uint8_t> pixels;        /** @brief Frame's pixels in RGBA32 format */
+            int width;                          /** @brief Width of frame in pixels */
+            int height;                         /** @brief Height of frame in pixels */
+            std::string path;                   /** @brief Path to write frame to */
+            CaptureFormat format;               /** @brief Format to write frame in */
+
+            /**
+             * @brief Implements \ref ThreadPool::Job::work() to encode and write the frame.
+             */
+            void work();
+
+        public:
+            /**
+             * @brief Constructs a new capture job, taking ownership of the pixels.
+             *
+             * @param renderer Renderer which captured the frame
+             * @param pixels Frame's pixels in RGBA32 format
+             * @param width Width of frame in pixels
+             * @param height Height of frame in pixels
+             * @param path Path to write frame to
+             * @param format Format to write frame in
+             */
+            CaptureJob(Renderer * renderer, std::vector<uint8_t> && pixels, const int width, const int height, const std::string & path, const CaptureFormat format);
+
+            /**
+             * @brief Destroys the capture job, marking the frame as no longer pending.
+             */
+            ~CaptureJob();
+    };
+};
+
+#endif
@@ -2,11 +2,17 @@
 #define AETHER_RENDERER_HPP
 
 #include "Aether/types/Colour.hpp"
+#include "Aether/types/ImageData.hpp"
+#include "Aether/utils/Types.hpp"
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <list>
+#include <map>
 #include <mutex>
-#include <stack>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 // Forward declare member types to reduce compilation time
@@ -18,6 +24,7 @@ struct SDL_Rect;
 struct SDL_Renderer;
 struct SDL_Surface;
 struct SDL_Texture;
+struct SDL_Vertex;
 struct SDL_Window;
 
 namespace Aether {
@@ -32,6 +39,10 @@ namespace Aether {
         friend Drawable;
         friend FontCache;
 
+        private:
+            // Forward declare nested class
+            class CaptureJob;
+
         public:
             /** @brief Function to handle log messages */
             typedef std::function<void(const std::string, const bool)> LogHandler;
@@ -39,15 +50,260 @@ namespace Aether {
         private:
             SDL_Renderer * renderer;                         /** @brief SDL renderer */
             SDL_Window * window;                             /** @brief SDL window object */
-            unsigned int windowWidth_;                       /** @brief Width of window */
-            unsigned int windowHeight_;                      /** @brief Height of window */
+            SDL_Surface * framebuffer;                       /** @brief Memory drawn into instead of the window when headless */
+            bool headless_;                                  /** @brief Whether running without a display */
+            unsigned int windowWidth_;                       /** @brief Logical width of window (used for layout) */
+            unsigned int windowHeight_;                      /** @brief Logical height of window (used for layout) */
+            unsigned int outputWidth_;                       /** @brief Actual width of window (in pixels) */
+            unsigned int outputHeight_;                      /** @brief Actual height of window (in pixels) */
+            float renderScale_;                              /** @brief Size of rendered frames relative to the logical size */
 
             LogHandler logHandler;                           /** @brief Handler for log messages */
             std::atomic<unsigned long> memoryUsage_;         /** @brief Number of bytes used by surfaces/textures */
             std::atomic<unsigned int> surfaceCount_;         /** @brief Number of created surfaces */
             std::atomic<unsigned int> textureCount_;         /** @brief Number of created textures */
 
-            std::stack<SDL_Rect *> clipStack;                /** @brief Stack of clipping rectangles */
+            /**
+             * @brief Types of commands that can be recorded in the draw queue
+             */
+            enum class DrawCommandType {
+                Clear,                                       /**< Clear the framebuffer with a colour */
+                Quad                                         /**< Draw a (possibly textured) rectangle */
+            };
+
+            /**
+             * @brief A single command recorded in the draw queue
+             */
+            struct DrawCommand {
+                DrawCommandType type;                        /** @brief Type of command */
+                SDL_Texture * texture;                       /** @brief Texture to draw (nullptr for a solid fill) */
+                Colour colour;                               /** @brief Colour to tint/fill with */
+                int x;                                       /** @brief Top-left x coordinate of quad */
+                int y;                                       /** @brief Top-left y coordinate of quad */
+                int w;                                       /** @brief Width of quad (0 once culled) */
+                int h;                                       /** @brief Height of quad */
+                float u1;                                    /** @brief Left texture coordinate */
+                float v1;                                    /** @brief Top texture coordinate */
+                float u2;                                    /** @brief Right texture coordinate */
+                float v2;                                    /** @brief Bottom texture coordinate */
+                bool opaque;                                 /** @brief Whether the quad completely hides what's beneath it */
+            };
+
+            /**
+             * @brief A simple rectangle
+             */
+            struct Rect {
+                int x;                                       /** @brief Top-left x coordinate */
+                int y;                                       /** @brief Top-left y coordinate */
+                int w;                                       /** @brief Width */
+                int h;                                       /** @brief Height */
+            };
+
+            static constexpr size_t maxClipDepth = 32;       /** @brief Number of nested clipping rectangles that are tracked */
+
+            /**
+             * @brief Fixed size stack of clipping rectangles, each already limited to the one beneath it.
+             * Pushes beyond the capacity are counted but reuse the top rectangle.
+             */
+            struct ClipStack {
+                Rect rects[maxClipDepth];                    /** @brief Clipping rectangles (relative to the current target) */
+                size_t depth;                                /** @brief Number of rectangles pushed */
+            };
+
+            ClipStack clipStack;                             /** @brief Clipping rectangles applied to queued quads */
+
+            std::vector<DrawCommand> drawQueue;              /** @brief Commands recorded since the queue was last flushed */
+            bool geometrySupported;                          /** @brief Whether the backend supports SDL_RenderGeometry */
+
+            /**
+             * @brief A run of commands which are submitted to the backend together
+             */
+            struct Batch {
+                DrawCommandType type;                        /** @brief Clear, or Quad for a run of quads */
+                SDL_Texture * texture;                       /** @brief Texture shared by the quads */
+                Colour colour;                               /** @brief Colour to clear with */
+                size_t first;                                /** @brief Index of first command in the queue */
+                size_t last;                                 /** @brief Index one past the last command in the queue */
+                size_t area;                                 /** @brief Index of the area being redrawn */
+                size_t vertex;                               /** @brief Index of first vertex */
+                size_t vertexCount;                          /** @brief Number of vertices (0 if drawn by copying) */
+                size_t index;                                /** @brief Index of first index */
+                size_t indexCount;                           /** @brief Number of indices */
+            };
+
+            /**
+             * @brief A recorded draw queue along with the batches and geometry formed from it,
+             * which doesn't depend on the backend so it can be prepared on another thread
+             */
+            struct PreparedFrame {
+                std::vector<DrawCommand> queue;              /** @brief Recorded commands */
+                bool wholeTarget;                            /** @brief Whether the whole target is redrawn (otherwise only areas) */
+                std::vector<Rect> areas;                     /** @brief Areas being redrawn */
+                std::vector<Batch> batches;                  /** @brief Batches to submit, in order */
+                std::vector<SDL_Vertex> vertices;            /** @brief Vertices of every batch */
+                std::vector<int> indices;                    /** @brief Indices of every batch (relative to the batch's first vertex) */
+                std::vector<Rect> occluders;                 /** @brief Opaque areas found while culling the queue */
+            };
+
+            PreparedFrame currentFrame;                      /** @brief Storage for preparing queues submitted immediately */
+
+            SDL_Texture * frameTexture;                      /** @brief Offscreen copy of the window, present when tracking damage or scaling */
+            bool damageTracking_;                            /** @brief Whether only damaged areas are redrawn */
+            std::vector<Rect> damage;                        /** @brief Areas of the window which need redrawing */
+            std::vector<Rect> frameDamage;                   /** @brief Areas being redrawn in the current frame */
+            bool frameStarted;                               /** @brief Whether the current frame's damaged areas have been fixed */
+
+            std::mutex opaqueMtx;                            /** @brief Mutex protecting opaqueSurfaces */
+            std::unordered_map<SDL_Surface *, Rect> opaqueSurfaces;  /** @brief Fully opaque area of unconverted surfaces */
+            std::unordered_map<SDL_Texture *, Rect> opaqueAreas;     /** @brief Fully opaque area of textures (in pixels) */
+
+            /**
+             * @brief An offscreen texture which draw commands are currently redirected to
+             */
+            struct Layer {
+                SDL_Texture * texture;                       /** @brief Texture being drawn on */
+                int x;                                       /** @brief X coordinate of texture on the outer target */
+                int y;                                       /** @brief Y coordinate of texture on the outer target */
+                ClipStack clipStack;                         /** @brief Clipping rectangles of the outer target */
+            };
+
+            std::vector<Layer> layers;                       /** @brief Stack of layers being drawn, innermost last */
+            int originX;                                     /** @brief X offset subtracted from queued coordinates (for layers) */
+            int originY;                                     /** @brief Y offset subtracted from queued coordinates (for layers) */
+
+            PresentMode presentMode_;                        /** @brief How frames are paced when presented */
+            unsigned int frameLimit_;                        /** @brief Frames per second when using PresentMode::Limited */
+            size_t uploadBudget_;                            /** @brief Bytes of surfaces which may be uploaded per frame (0 if unlimited) */
+            size_t uploadedBytes;                            /** @brief Bytes of surfaces uploaded in the current frame */
+            bool lowMemory_;                                 /** @brief Whether textures are stored in 16-bit formats where possible */
+            uint64_t lastFrame;                              /** @brief Performance counter value when the last limited frame ended */
+            uint64_t lastPresent;                            /** @brief Performance counter value when the last frame was presented */
+            FrameStats frameStats_;                          /** @brief Measurements of the last presented frame */
+            size_t submittedCommands;                        /** @brief Draw commands submitted in the current frame */
+            size_t submittedBatches;                         /** @brief Batches submitted in the current frame */
+
+            RendererInfo info_;                              /** @brief Capabilities of the backend in use */
+
+            bool pipelined_;                                 /** @brief Whether frames are prepared on the pipeline thread */
+            std::thread pipelineThread;                      /** @brief Thread preparing the pending frame */
+            std::mutex pipelineMtx;                          /** @brief Mutex protecting the pending frame's state */
+            std::condition_variable pipelineCond;            /** @brief Signalled when the pending frame's state changes */
+            PreparedFrame pendingFrame;                      /** @brief Frame handed to the pipeline thread */
+            bool pendingGeometry;                            /** @brief Whether the pending frame should form geometry */
+            bool framePending;                               /** @brief Whether a frame is waiting to be submitted */
+            bool pendingReady;                               /** @brief Whether the pending frame has been prepared */
+            bool pipelineStop;                               /** @brief Set to stop the pipeline thread */
+
+            bool capturing_;                                 /** @brief Whether every presented frame is being written to disk */
+            std::string captureDir;                          /** @brief Directory captured frames are written to */
+            CaptureFormat captureFormat;                     /** @brief Format captured frames are written in */
+            unsigned int captureCount;                       /** @brief Number of frames captured so far */
+            unsigned int droppedCaptures;                    /** @brief Number of frames skipped as encoding fell behind */
+            std::string screenshotPath;                      /** @brief Path to save the next presented frame to (empty if none) */
+            std::atomic<unsigned int> pendingCaptures;       /** @brief Number of captured frames waiting to be written */
+
+            /**
+             * @brief A texture (or image within an atlas page) waiting to be destroyed
+             */
+            struct ReleasedTexture {
+                SDL_Texture * texture;                       /** @brief Released texture */
+                bool atlas;                                  /** @brief Whether only an image within the texture was released */
+                int x;                                       /** @brief X coordinate of image within atlas page */
+                int y;                                       /** @brief Y coordinate of image within atlas page */
+            };
+
+            std::mutex releaseMtx;                           /** @brief Mutex protecting the queues of released textures and discarded drawables */
+            std::vector<ReleasedTexture> releasedTextures;   /** @brief Textures released since the last frame was presented */
+            std::vector<Drawable *> discardedDrawables;      /** @brief Drawables waiting to be deleted on the main thread */
+            std::vector<ReleasedTexture> pendingReleases;    /** @brief Textures released while the pending frame was drawn */
+            std::atomic<size_t> releasedBytes;               /** @brief Bytes of released textures waiting to be destroyed */
+
+            size_t textureBudget_;                           /** @brief Bytes of surfaces/textures which may be allocated (0 if unlimited) */
+            unsigned int frameCount_;                        /** @brief Number of frames started */
+
+            std::atomic<bool> frameRequested_;               /** @brief Whether another frame has been requested since last checked */
+            uint32_t wakeEvent;                              /** @brief Registered event type used to wake the main loop */
+
+            /**
+             * @brief Parameters a shape is rasterized with, which uniquely identify it's pixels
+             */
+            struct ShapeKey {
+                int width;                                   /** @brief Width of shape */
+                int height;                                  /** @brief Height of shape */
+                float rx;                                    /** @brief Horizontal corner radius */
+                float ry;                                    /** @brief Vertical corner radius */
+                float thick;                                 /** @brief Thickness of outline (0 if filled) */
+
+                bool operator<(const ShapeKey & other) const;
+            };
+
+            /**
+             * @brief A shape texture shared between Drawables
+             */
+            struct CachedShape {
+                SDL_Texture * texture;                       /** @brief Shared texture */
+                unsigned int refs;                           /** @brief Number of Drawables using the texture */
+            };
+
+            std::mutex shapeMtx;                             /** @brief Mutex protecting the shape cache */
+            std::map<ShapeKey, CachedShape> shapeCache;      /** @brief Textures of rendered shapes */
+            std::unordered_map<SDL_Texture *, ShapeKey> cachedTextures;  /** @brief Shape that each cached texture is for */
+            std::unordered_map<SDL_Surface *, ShapeKey> pendingShapes;   /** @brief Shape that each unconverted surface is for */
+            std::atomic<unsigned int> shapeCacheHits_;       /** @brief Number of shapes served from the cache */
+            std::atomic<unsigned int> shapeCacheMisses_;     /** @brief Number of shapes that needed rasterizing */
+            std::atomic<unsigned long> shapeCacheMemory_;    /** @brief Number of bytes used by cached shape textures */
+
+            /**
+             * @brief Properties a released texture must match to be reused
+             */
+            struct PoolKey {
+                uint32_t format;                             /** @brief Pixel format */
+                int access;                                  /** @brief SDL_TextureAccess value */
+                int width;                                   /** @brief Width in pixels */
+                int height;                                  /** @brief Height in pixels */
+
+                bool operator<(const PoolKey & other) const;
+            };
+
+            /**
+             * @brief A released texture waiting to be reused
+             */
+            struct PooledTexture {
+                PoolKey key;                                 /** @brief Properties of texture */
+                SDL_Texture * texture;                       /** @brief Idle texture */
+            };
+
+            std::list<PooledTexture> texturePool;            /** @brief Released textures, least recently released first */
+            std::map<PoolKey, std::vector<std::list<PooledTexture>::iterator>> poolIndex;    /** @brief Pooled textures grouped by their properties */
+            size_t poolLimit_;                               /** @brief Maximum bytes of idle textures kept (0 to disable pooling) */
+            size_t poolMemory_;                              /** @brief Bytes of idle textures in the pool */
+            unsigned int poolHits_;                          /** @brief Number of textures served from the pool */
+            unsigned int poolMisses_;                        /** @brief Number of textures that needed creating */
+
+            /**
+             * @brief A row of images within an atlas page
+             */
+            struct AtlasShelf {
+                int y;                                       /** @brief Top of shelf */
+                int height;                                  /** @brief Height of shelf */
+                int cursor;                                  /** @brief Start of the unused space at the end of the shelf */
+                std::vector<Rect> gaps;                      /** @brief Areas freed before the cursor */
+            };
+
+            /**
+             * @brief A texture shared between small images, which are packed into shelves
+             */
+            struct AtlasPage {
+                SDL_Texture * texture;                       /** @brief Shared texture */
+                uint32_t format;                             /** @brief Pixel format of texture */
+                int size;                                    /** @brief Width and height of texture */
+                int nextY;                                   /** @brief Top of the next shelf to be added */
+                std::vector<AtlasShelf> shelves;             /** @brief Shelves in the page, from top to bottom */
+                std::map<std::pair<int, int>, Rect> entries; /** @brief Area allocated to each image, by the image's position */
+            };
+
+            std::vector<AtlasPage> atlasPages;               /** @brief Pages small images are packed into */
+            unsigned int atlasPageSize_;                     /** @brief Width and height of each atlas page (0 if disabled) */
 
             FontCache * fontCache;                           /** @brief Object that cache's font data */
             double fontSpacing;                              /** @brief Height of one line of wrapped text (multiple of line height) */
@@ -69,18 +325,62 @@ namespace Aether {
              * @note Must be called in the same thread that initialized the renderer.
              *
              * @param surf The surface to convert
+             * @param format Pixel format to store the texture in
              * @return The created texture, or nullptr if an error occurred.
              */
-            SDL_Texture * convertSurfaceToTexture(SDL_Surface * surf);
+            SDL_Texture * convertSurfaceToTexture(SDL_Surface * surf, const TextureFormat format = TextureFormat::Auto);
+
+            /**
+             * @brief Pick the SDL pixel format to upload a surface with, falling back to RGBA32 if
+             * the backend doesn't support the preferred format.
+             *
+             * @param format Requested texture format
+             * @param opaque Whether every pixel of the surface is opaque
+             * @return SDL_PixelFormatEnum value
+             */
+            uint32_t chooseTextureFormat(const TextureFormat format, const bool opaque);
+
+            /**
+             * @brief Returns the number of bytes of memory used by a texture, based on it's real format.
+             *
+             * @param tex Texture to measure
+             * @return Size of texture in bytes
+             */
+            static size_t textureBytes(SDL_Texture * tex);
+
+            /**
+             * @brief Take a released texture with the given properties from the pool. It's
+             * colour/alpha modulation is reset, but it still holds it's previous pixels.
+             *
+             * @param key Properties of wanted texture
+             * @return Pooled texture, or nullptr if there isn't one
+             */
+            SDL_Texture * takePooledTexture(const PoolKey & key);
+
+            /**
+             * @brief Keep a texture that is no longer used in the pool for reuse.
+             *
+             * @param tex Texture to pool
+             * @return Whether the texture was pooled (otherwise it should be destroyed)
+             */
+            bool poolTexture(SDL_Texture * tex);
+
+            /**
+             * @brief Destroy the least recently pooled textures until the pool fits within a limit.
+             *
+             * @param limit Maximum bytes of idle textures to keep
+             */
+            void trimTexturePool(const size_t limit);
 
             /**
              * @brief Create a blank, transparent texture with the given dimensions.
              *
              * @param width Required width
              * @param height Required height
+             * @param streaming Whether the texture's pixels are updated from the CPU instead of being drawn on
              * @return The created texture, or nullptr if an error occurred.
              */
-            SDL_Texture * createTexture(const unsigned int width, const unsigned int height);
+            SDL_Texture * createTexture(const unsigned int width, const unsigned int height, const bool streaming = false);
 
             /**
              * @brief Destroy the given texture. Does nothing if passed nullptr.
@@ -90,6 +390,68 @@ namespace Aether {
              */
             void destroyTexture(SDL_Texture * tex, const bool stats);
 
+            /**
+             * @brief Queue the given texture to be destroyed once every frame that may draw it has been
+             * presented, so textures are released in bulk rather than stalling wherever they're dropped.
+             * @note Safe to call from any thread.
+             *
+             * @param tex Texture to release
+             */
+            void releaseTexture(SDL_Texture * tex);
+
+            /**
+             * @brief Queue an image packed into an atlas page to be removed, in the same way as
+             * \ref releaseTexture().
+             * @note Safe to call from any thread.
+             *
+             * @param tex Atlas page containing the image
+             * @param x X coordinate of image within page
+             * @param y Y coordinate of image within page
+             */
+            void releaseAtlasImage(SDL_Texture * tex, const int x, const int y);
+
+            /**
+             * @brief Delete every drawable queued by \ref discardDrawable().
+             */
+            void deleteDiscardedDrawables();
+
+            /**
+             * @brief Destroy each of the given released textures, emptying the vector.
+             *
+             * @param textures Textures to destroy
+             */
+            void destroyReleasedTextures(std::vector<ReleasedTexture> & textures);
+
+            /**
+             * @brief Pack a small surface into a shared atlas page. The surface is freed on success.
+             *
+             * @param surf Surface to pack
+             * @param x Set to the X coordinate of the image within the page
+             * @param y Set to the Y coordinate of the image within the page
+             * @return Atlas page containing the image, or nullptr if it couldn't be packed
+             */
+            SDL_Texture * addToAtlas(SDL_Surface * surf, int & x, int & y);
+
+            /**
+             * @brief Find space on a page for an image, using the first shelf it fits on or starting a new shelf.
+             *
+             * @param page Page to search
+             * @param w Width of space needed
+             * @param h Height of space needed
+             * @param area Set to the allocated area
+             * @return Whether space was found
+             */
+            static bool allocateAtlasArea(AtlasPage & page, const int w, const int h, Rect & area);
+
+            /**
+             * @brief Return an image's space to it's atlas page, destroying the page once it's empty.
+             *
+             * @param tex Atlas page containing the image
+             * @param x X coordinate of image within page
+             * @param y Y coordinate of image within page
+             */
+            void removeFromAtlas(SDL_Texture * tex, const int x, const int y);
+
             /**
              * @brief Destroy the given surface. Does nothing if passed nullptr.
              *
@@ -99,7 +461,175 @@ namespace Aether {
             void destroySurface(SDL_Surface * surf, const bool stats);
 
             /**
-             * @brief Draw a filled rectangle to the framebuffer with the given position + dimensions.
+             * @brief Submit all commands in the draw queue to the backend, merging consecutive
+             * quads which share a texture into a single draw call.
+             * @note This is called automatically by \ref present(), and whenever a texture
+             * is destroyed while queued commands use it.
+             */
+            void flushDrawQueue();
+
+            /**
+             * @brief Returns whether any queued command draws the given texture, or draws onto it
+             * (as the current layer).
+             *
+             * @param tex Texture to look for
+             *
+             * @return Whether the texture is used by the draw queue
+             */
+            bool drawQueueUses(SDL_Texture * tex);
+
+            /**
+             * @brief Walk a draw queue from front to back, marking quads that are completely
+             * covered by later opaque quads so they aren't submitted.
+             *
+             * @param queue Queue to cull
+             * @param occluders Storage for the opaque areas found
+             */
+            static void cullOccludedQuads(std::vector<DrawCommand> & queue, std::vector<Rect> & occluders);
+
+            /**
+             * @brief Cull a frame's queue and group it into batches, forming geometry for each.
+             * @note This doesn't touch the backend, so it's safe to call from any thread.
+             *
+             * @param frame Frame to prepare
+             * @param geometry Whether to form geometry (otherwise quads are copied one by one)
+             */
+            static void prepareFrame(PreparedFrame & frame, const bool geometry);
+
+            /**
+             * @brief Append a batch for the given run of quads to a frame, forming it's geometry.
+             *
+             * @param frame Frame to add batch to
+             * @param first Index of first quad in the frame's queue
+             * @param last Index one past the last quad in the frame's queue
+             * @param area Index of the area being redrawn
+             * @param geometry Whether to form geometry
+             */
+            static void addBatch(PreparedFrame & frame, const size_t first, const size_t last, const size_t area, const bool geometry);
+
+            /**
+             * @brief Returns whether a quad can be left out of a batch, as it's been culled or is
+             * entirely outside of the area being redrawn.
+             *
+             * @param cmd Quad to check
+             * @param clip Area being redrawn, or nullptr if drawing everywhere
+             * @return true if the quad isn't visible, false otherwise
+             */
+            static bool skipQuad(const DrawCommand & cmd, const Rect * clip);
+
+            /**
+             * @brief Submit a prepared frame's batches to the current render target.
+             *
+             * @param frame Frame to submit
+             */
+            void submitFrame(PreparedFrame & frame);
+
+            /**
+             * @brief Submit a prepared frame to the window (or it's offscreen copy).
+             *
+             * @param frame Frame to submit
+             */
+            void submitToWindow(PreparedFrame & frame);
+
+            /**
+             * @brief Fix the areas of the window redrawn this frame, storing them in the given frame.
+             *
+             * @param frame Frame to store areas in
+             */
+            void freezeDamage(PreparedFrame & frame);
+
+            /**
+             * @brief Show everything submitted to the window.
+             */
+            void presentFrame();
+
+            /**
+             * @brief Wait for the pending frame to be prepared, then submit and show it. Called before
+             * anything which could change what the pending frame draws. Does nothing if there isn't one.
+             */
+            void finishPendingFrame();
+
+            /**
+             * @brief Returns whether the pending frame draws the given texture, in which case it must be
+             * finished before the texture's contents change. Only reads each command's texture, which the
+             * pipeline thread never modifies.
+             *
+             * @param tex Texture to look for
+             *
+             * @return Whether the texture is drawn by the pending frame
+             */
+            bool pendingFrameUses(SDL_Texture * tex);
+
+            /**
+             * @brief Body of the pipeline thread, which prepares each pending frame.
+             */
+            void pipelineLoop();
+
+            /**
+             * @brief Read back the frame about to be presented and queue it to be written to disk,
+             * for screenshots and frame capture.
+             */
+            void captureFrame();
+
+            /**
+             * @brief Wait until the next frame is due when limiting the frame rate. Most of the time
+             * is slept, with the remainder spun on as sleeping isn't precise enough.
+             */
+            void limitFrameRate();
+
+            /**
+             * @brief Render a fixed workload with the given driver and measure how long it takes.
+             *
+             * @param index Index of SDL render driver
+             * @return Time taken (in seconds), or a negative value if the driver couldn't be used
+             */
+            double benchmarkDriver(const int index);
+
+            /**
+             * @brief Pick the index of the SDL render driver to create the renderer with.
+             *
+             * @param driver Name of requested driver (see \ref initialize())
+             * @return Index of driver
+             */
+            int chooseDriver(const std::string & driver);
+
+            /**
+             * @brief (Re)create or destroy the offscreen copy of the window to match the current
+             * damage tracking, logical size and render scale.
+             *
+             * @return true if successful, false otherwise
+             */
+            bool updateFrameTexture();
+
+            /**
+             * @brief Record the given RGBA32 surface as opaque if none of it's pixels are transparent,
+             * so that quads drawn with it can hide what's beneath them.
+             *
+             * @param surf Surface to check
+             */
+            void markIfOpaque(SDL_Surface * surf);
+
+            /**
+             * @brief Trim a quad to the current clipping rectangle, adjusting it's texture
+             * coordinates to match.
+             *
+             * @param cmd Quad to trim (relative to the current target)
+             * @return false if the quad is entirely clipped, true otherwise
+             */
+            bool clipQuad(DrawCommand & cmd);
+
+            /**
+             * @brief Submit the given range of quads one at a time, for backends which can't draw geometry.
+             *
+             * @param queue Queue containing the quads
+             * @param first Index of first quad in the queue
+             * @param last Index one past the last quad in the queue
+             * @param clip Area being redrawn used to skip hidden quads, or nullptr if drawing everywhere
+             */
+            void submitCopies(const std::vector<DrawCommand> & queue, const size_t first, const size_t last, const Rect * clip);
+
+            /**
+             * @brief Queue a filled rectangle to be drawn to the framebuffer with the given position + dimensions.
              *
              * @param col Colour to fill rectangle with
              * @param x Top-left x coordinate
@@ -110,7 +640,7 @@ namespace Aether {
             void drawFilledRect(const Colour & col, const int x, const int y, const int width, const int height);
 
             /**
-             * @brief Draw the given texture to the framebuffer.
+             * @brief Queue the given texture to be drawn to the framebuffer.
              *
              * @param tex The texture to render
              * @param col Colour to tint texture with
@@ -125,6 +655,22 @@ namespace Aether {
              */
             void drawTexture(SDL_Texture * tex, const Colour & col, const int x, const int y, const unsigned int width, const unsigned int height, const int maskX, const int maskY, const unsigned int maskW, const unsigned int maskH);
 
+            /**
+             * @brief Queue a (sub-pixel) region of the given texture to be drawn to the framebuffer.
+             *
+             * @param tex The texture to render
+             * @param col Colour to tint texture with
+             * @param x Top-left x coordinate
+             * @param y Top-left y coordinate
+             * @param width Width of area to stretch region to
+             * @param height Height of area to stretch region to
+             * @param srcX Top-left x coordinate of region (in texture pixels)
+             * @param srcY Top-left y coordinate of region (in texture pixels)
+             * @param srcW Width of region (in texture pixels)
+             * @param srcH Height of region (in texture pixels)
+             */
+            void drawTextureRegion(SDL_Texture * tex, const Colour & col, const int x, const int y, const int width, const int height, const float srcX, const float srcY, const float srcW, const float srcH);
+
             /**
              * @brief Perform all actions in the passed function on the given texture.
              * Also clears existing content on texture.
@@ -134,6 +680,35 @@ namespace Aether {
              */
             void renderOnTexture(SDL_Texture * tex, const std::function<void(SDL_Renderer *)> & func);
 
+            /**
+             * @brief Rasterize an anti-aliased white (rounded) rectangle or ellipse into a new surface,
+             * updating usage stats.
+             * @note This is thread-safe.
+             *
+             * @param width Width of surface
+             * @param height Height of surface
+             * @param rx Horizontal corner radius
+             * @param ry Vertical corner radius
+             * @param thick Thickness of outline (0 to fill)
+             * @return The created surface, or nullptr if an error occurred.
+             */
+            SDL_Surface * rasterizeShape(const int width, const int height, const float rx, const float ry, const float thick);
+
+            /**
+             * @brief Return a Drawable for the given shape. If the shape has already been rendered it's
+             * texture is shared, otherwise the shape is rasterized into a surface which will be added to
+             * the cache when converted to a texture.
+             * @note This is thread-safe.
+             *
+             * @param width Width of shape
+             * @param height Height of shape
+             * @param rx Horizontal corner radius
+             * @param ry Vertical corner radius
+             * @param thick Thickness of outline (0 to fill)
+             * @return Drawable containing either the shape's texture or surface, or nothing on an error (Type set as None).
+             */
+            Drawable * renderShape(const int width, const int height, const float rx, const float ry, const float thick);
+
             /**
              * @brief Scales the provided surface to the requested dimensions.
              * This method will always return a valid surface, even if scaling fails.
@@ -169,10 +744,62 @@ namespace Aether {
              * @param name Name of window
              * @param windowW Width of window to create
              * @param windowH Height of window to create
+             * @param mode How frames are paced when presented
+             * @param driver Name of the SDL render driver to use (see \ref availableDrivers()), "fastest"
+             * to benchmark each available driver and use the quickest, or empty to use the default
+             * @param headless Whether to run without a display, drawing with the CPU into memory using SDL's
+             * dummy video driver (the mode and driver are ignored and frames are presented uncapped)
              *
              * @return true on success, false otherwise
              */
-            bool initialize(const std::string & name, const unsigned int windowW, const unsigned int windowH);
+            bool initialize(const std::string & name, const unsigned int windowW, const unsigned int windowH, const PresentMode mode = PresentMode::VSync, const std::string & driver = "", const bool headless = false);
+
+            /**
+             * @brief Returns whether the renderer is running without a display.
+             *
+             * @return Whether the renderer is headless
+             */
+            bool headless();
+
+            /**
+             * @brief Returns the capabilities of every render driver SDL was built with. Can be
+             * called before the renderer is initialized. Geometry support is only known once a
+             * driver is in use, so it is always reported as false here (see \ref info()).
+             *
+             * @return Information about each driver
+             */
+            static std::vector<RendererInfo> availableDrivers();
+
+            /**
+             * @brief Returns the capabilities of the backend being rendered with.
+             *
+             * @return Information about backend in use
+             */
+            RendererInfo info();
+
+            /**
+             * @brief Returns the largest width a texture can have. Anything wider must be split
+             * into multiple textures.
+             *
+             * @return Maximum texture width (0 if unlimited or not initialized)
+             */
+            unsigned int maxTextureWidth();
+
+            /**
+             * @brief Returns the largest height a texture can have. Anything taller must be split
+             * into multiple textures.
+             *
+             * @return Maximum texture height (0 if unlimited or not initialized)
+             */
+            unsigned int maxTextureHeight();
+
+            /**
+             * @brief Returns whether the backend can create textures in the given format.
+             *
+             * @param format SDL_PixelFormatEnum value
+             * @return true if supported, false otherwise
+             */
+            bool supportsTextureFormat(const uint32_t format);
 
             /**
              * @brief Clean up the rendering backend. This should always be called, even if
@@ -181,8 +808,8 @@ namespace Aether {
             void cleanup();
 
             /**
-             * @brief Returns an approximated value for memory used by all rendered textures.
-             * @note This isn't very accurate, it is useful for estimation purposes only.
+             * @brief Returns the memory used by all rendered textures and surfaces, based on their pixel formats.
+             * @note Backends may pad or align textures, so this is still an estimate.
              *
              * @return Number of *bytes* allocated to all current textures/surfaces.
              */
@@ -203,19 +830,112 @@ namespace Aether {
             unsigned int textureCount();
 
             /**
-             * @brief Returns the width of the window.
+             * @brief Returns measurements of the most recently presented frame.
+             *
+             * @return Statistics of the last frame
+             */
+            FrameStats frameStats();
+
+            /**
+             * @brief Returns the number of shape textures which were shared from the shape cache
+             * instead of being rendered again.
+             *
+             * @return Number of cache hits since initialization.
+             */
+            unsigned int shapeCacheHits();
+
+            /**
+             * @brief Returns the number of shapes which had to be rendered as they weren't cached.
+             *
+             * @return Number of cache misses since initialization.
+             */
+            unsigned int shapeCacheMisses();
+
+            /**
+             * @brief Returns the approximate memory used by textures in the shape cache. This is
+             * included in \ref memoryUsage().
+             *
+             * @return Number of *bytes* allocated to cached shape textures.
+             */
+            unsigned long shapeCacheMemory();
+
+            /**
+             * @brief Returns the number of textures which were reused from the pool of released textures.
+             *
+             * @return Number of pool hits since initialization.
+             */
+            unsigned int texturePoolHits();
+
+            /**
+             * @brief Returns the number of textures which had to be created as no matching texture was pooled.
+             *
+             * @return Number of pool misses since initialization.
+             */
+            unsigned int texturePoolMisses();
+
+            /**
+             * @brief Returns the memory used by idle textures in the pool. This is included in
+             * \ref memoryUsage(), and the textures are included in \ref textureCount().
+             *
+             * @return Number of *bytes* allocated to pooled textures.
+             */
+            size_t texturePoolMemory();
+
+            /**
+             * @brief Returns the logical width of the window, which everything is laid out within.
              *
              * @return Width of rendering window.
              */
             unsigned int windowWidth();
 
             /**
-             * @brief Returns the height of the window.
+             * @brief Returns the logical height of the window, which everything is laid out within.
              *
              * @return Height of rendering window.
              */
             unsigned int windowHeight();
 
+            /**
+             * @brief Returns the actual width of the window (in pixels).
+             *
+             * @return Width of window
+             */
+            unsigned int outputWidth();
+
+            /**
+             * @brief Returns the actual height of the window (in pixels).
+             *
+             * @return Height of window
+             */
+            unsigned int outputHeight();
+
+            /**
+             * @brief Set the logical size of the window, which is the coordinate space everything
+             * is positioned in. Frames are stretched to fill the actual window when presented.
+             * @note Defaults to the size of the window.
+             *
+             * @param width Logical width
+             * @param height Logical height
+             * @return true if successful, false otherwise
+             */
+            bool setLogicalSize(const unsigned int width, const unsigned int height);
+
+            /**
+             * @brief Set the resolution frames are rendered at, relative to the logical size. Rendering
+             * at a lower resolution and upscaling when presented reduces the work done by the GPU.
+             *
+             * @param scale Scale factor (1 to render at the logical size)
+             * @return true if successful, false otherwise
+             */
+            bool setRenderScale(const float scale);
+
+            /**
+             * @brief Returns the resolution frames are rendered at, relative to the logical size.
+             *
+             * @return Render scale factor
+             */
+            float renderScale();
+
             /**
              * @brief Fill the window with the given colour
              *
@@ -224,10 +944,311 @@ namespace Aether {
             void fillWindow(const Colour & col);
 
             /**
-             * @brief Present all rendered graphics
+             * @brief Submit all queued draw commands and present the rendered graphics
              */
             void present();
 
+            /**
+             * @brief Set how frames are paced when presented.
+             *
+             * @param mode Present mode to use
+             * @return true if successful, false if the backend couldn't change vsync
+             */
+            bool setPresentMode(const PresentMode mode);
+
+            /**
+             * @brief Returns how frames are paced when presented.
+             *
+             * @return Current present mode
+             */
+            PresentMode presentMode();
+
+            /**
+             * @brief Set the frame rate to limit to when using PresentMode::Limited.
+             *
+             * @param fps Frames per second (must be non-zero)
+             */
+            void setFrameLimit(const unsigned int fps);
+
+            /**
+             * @brief Returns the frame rate limited to when using PresentMode::Limited.
+             *
+             * @return Frames per second
+             */
+            unsigned int frameLimit();
+
+            /**
+             * @brief Set how many bytes of surfaces may be uploaded as textures each frame. Elements
+             * rendered asynchronously wait for a later frame once this is used up, spreading the cost
+             * of many images finishing at once over several frames.
+             * @note The first upload in a frame is always allowed so large surfaces aren't starved.
+             *
+             * @param bytes Maximum bytes per frame, or 0 for no limit
+             */
+            void setUploadBudget(const size_t bytes);
+
+            /**
+             * @brief Returns how many bytes of surfaces may be uploaded each frame.
+             *
+             * @return Upload budget in bytes (0 if unlimited)
+             */
+            size_t uploadBudget();
+
+            /**
+             * @brief Set how many bytes of released textures are kept to be reused by new textures with
+             * the same size and format, instead of asking the driver to destroy and create them.
+             *
+             * @param bytes Maximum bytes of idle textures, or 0 to disable pooling
+             */
+            void setTexturePoolLimit(const size_t bytes);
+
+            /**
+             * @brief Returns how many bytes of released textures may be kept for reuse.
+             *
+             * @return Texture pool limit in bytes (0 if disabled)
+             */
+            size_t texturePoolLimit();
+
+            /**
+             * @brief Set the number of bytes surfaces and textures may use in total. When exceeded, idle pooled
+             * textures are destroyed first, and then the textures of Texture elements which haven't been drawn
+             * recently, least recently drawn first. Evicted elements are rendered again when next drawn.
+             *
+             * @param bytes Maximum bytes of surfaces/textures, or 0 for no limit
+             */
+            void setTextureBudget(const size_t bytes);
+
+            /**
+             * @brief Returns the number of bytes surfaces and textures may use in total.
+             *
+             * @return Texture budget in bytes (0 if unlimited)
+             */
+            size_t textureBudget();
+
+            /**
+             * @brief Returns how far memory usage is over the texture budget, after first destroying idle pooled
+             * textures. Textures already released but not yet destroyed aren't counted.
+             *
+             * @return Number of bytes which need to be freed (0 if within budget)
+             */
+            size_t textureBudgetExcess();
+
+            /**
+             * @brief Returns the number of frames started so far, which can be used to tell when something was last drawn.
+             *
+             * @return Number of frames
+             */
+            unsigned int frameCount();
+
+            /**
+             * @brief Set the size of the shared textures small images are packed into. Drawables marked
+             * with \ref Drawable::setAtlas() which fit are packed into these pages instead of getting a
+             * texture each, and pages are destroyed once all of their images are.
+             * @note Only affects images converted afterwards.
+             *
+             * @param size Width and height of each page, or 0 to disable packing
+             */
+            void setAtlasPageSize(const unsigned int size);
+
+            /**
+             * @brief Returns the size of the shared textures small images are packed into.
+             *
+             * @return Width and height of each atlas page (0 if disabled)
+             */
+            unsigned int atlasPageSize();
+
+            /**
+             * @brief Returns the number of atlas pages currently allocated.
+             *
+             * @return Number of atlas pages
+             */
+            unsigned int atlasPageCount();
+
+            /**
+             * @brief Set whether textures using TextureFormat::Auto are stored in 16-bit formats
+             * (RGB565 for opaque images, RGBA4444 otherwise) where the backend supports them. This
+             * halves texture memory at the cost of colour banding.
+             * @note Only affects textures created afterwards.
+             *
+             * @param enable Whether to use low memory formats
+             */
+            void setLowMemoryTextures(const bool enable);
+
+            /**
+             * @brief Returns whether textures are stored in 16-bit formats where possible.
+             *
+             * @return true if low memory formats are used, false otherwise
+             */
+            bool lowMemoryTextures();
+
+            /**
+             * @brief Claim part of the current frame's upload budget. If there isn't enough left
+             * the upload should be attempted again next frame.
+             *
+             * @param bytes Number of bytes about to be uploaded
+             * @return true if the upload may go ahead, false otherwise
+             */
+            bool reserveUpload(const size_t bytes);
+
+            /**
+             * @brief Set whether only damaged areas of the window are redrawn. When enabled, the
+             * window's contents are kept in a texture and each frame only redraws the areas
+             * reported with \ref addDamage() (or everything after \ref damageAll()).
+             * @note Elements report changes made through their own methods, but anything drawn outside
+             * of these must report it's own damage.
+             *
+             * @param enable Whether to enable damage tracking
+             * @return true if successful, false otherwise
+             */
+            bool setDamageTracking(const bool enable);
+
+            /**
+             * @brief Returns whether damage tracking is enabled (see \ref setDamageTracking()).
+             *
+             * @return true if only damaged areas are redrawn, false otherwise
+             */
+            bool damageTracking();
+
+            /**
+             * @brief Set whether frames are pipelined. When enabled, \ref present() hands the frame's
+             * recorded commands to another thread which culls and batches them while the next frame is
+             * updated, and the frame is submitted and shown at the start of the next \ref present().
+             * This overlaps CPU work at the cost of one frame of latency.
+             * @note Destroying textures or updating streaming textures while a frame is pending submits it early.
+             *
+             * @param enable Whether to pipeline frames
+             */
+            void setPipelined(const bool enable);
+
+            /**
+             * @brief Returns whether frames are pipelined.
+             *
+             * @return true if frames are pipelined, false otherwise
+             */
+            bool pipelined();
+
+            /**
+             * @brief Mark an area of the window as needing to be redrawn on the next frame.
+             * This also requests another frame (see \ref requestFrame()), but otherwise has no
+             * effect if damage tracking is disabled.
+             *
+             * @param x Top-left x coordinate
+             * @param y Top-left y coordinate
+             * @param w Width of area
+             * @param h Height of area
+             */
+            void addDamage(const int x, const int y, const int w, const int h);
+
+            /**
+             * @brief Mark the whole window as needing to be redrawn on the next frame.
+             * This also requests another frame (see \ref requestFrame()), but otherwise has no
+             * effect if damage tracking is disabled.
+             */
+            void damageAll();
+
+            /**
+             * @brief Create an offscreen texture which can be drawn on with \ref beginLayer().
+             * It's contents are stored with premultiplied alpha and blended accordingly when rendered.
+             *
+             * @param width Width of layer (in pixels)
+             * @param height Height of layer (in pixels)
+             * @return Drawable containing the layer's texture, or an empty Drawable on an error
+             */
+            Drawable * createLayer(const unsigned int width, const unsigned int height);
+
+            /**
+             * @brief Redirect all following drawing onto the given layer (which is cleared first)
+             * until \ref endLayer() is called. Coordinates remain relative to the window, with the
+             * layer covering the area starting at the given position. Layers can be nested.
+             *
+             * @param layer Layer created with \ref createLayer()
+             * @param x X coordinate on the window of the layer's top-left corner
+             * @param y Y coordinate on the window of the layer's top-left corner
+             * @return true if drawing was redirected, false otherwise
+             */
+            bool beginLayer(Drawable * layer, const int x, const int y);
+
+            /**
+             * @brief Finish drawing on the current layer, returning to the previous target.
+             */
+            void endLayer();
+
+            /**
+             * @brief Create a texture whose pixels are regularly replaced from the CPU with
+             * \ref updateStreamingTexture(). Pixels are stored as RGBA32.
+             *
+             * @param width Width of texture (in pixels)
+             * @param height Height of texture (in pixels)
+             * @return Drawable containing the texture, or an empty Drawable on an error
+             */
+            Drawable * createStreamingTexture(const unsigned int width, const unsigned int height);
+
+            /**
+             * @brief Upload part of a RGBA32 pixel buffer to a texture created with \ref createStreamingTexture().
+             *
+             * @param drawable Drawable containing the texture
+             * @param pixels Pointer to the first pixel of the whole buffer
+             * @param pitch Number of bytes in one row of the buffer
+             * @param x X coordinate of area to upload
+             * @param y Y coordinate of area to upload
+             * @param w Width of area to upload
+             * @param h Height of area to upload
+             * @return true if successful, false otherwise
+             */
+            bool updateStreamingTexture(Drawable * drawable, const uint8_t * pixels, const size_t pitch, const int x, const int y, const int w, const int h);
+
+            /**
+             * @brief Request that another frame is drawn straight after the current one,
+             * preventing the main loop from idling. Anything animating should call this every frame.
+             * @note Safe to call from any thread.
+             */
+            void requestFrame();
+
+            /**
+             * @brief Returns whether a frame has been requested since this was last called,
+             * clearing the request.
+             *
+             * @return true if another frame is needed, false otherwise
+             */
+            bool frameRequested();
+
+            /**
+             * @brief Wake up the main loop if it is waiting in \ref waitForEvent(), and request
+             * another frame.
+             * @note Safe to call from any thread.
+             */
+            void wakeUp();
+
+            /**
+             * @brief Queue a drawable to be deleted on the main thread before the next frame, such as an
+             * asynchronous render's result which is no longer wanted. Deleting a drawable may release a
+             * texture, which can't be done from another thread.
+             * @note Safe to call from any thread.
+             *
+             * @param drawable Drawable to delete
+             */
+            void discardDrawable(Drawable * drawable);
+
+            /**
+             * @brief Block until an event is available (without removing it) or the timeout passes.
+             *
+             * @param timeout Maximum time to wait (in ms)
+             * @return true if an event is available, false if timed out
+             */
+            bool waitForEvent(const int timeout);
+
+            /**
+             * @brief Returns whether the given area lies entirely outside of the current clipping area,
+             * in which case nothing drawn within it will be visible.
+             *
+             * @param x Top-left x coordinate
+             * @param y Top-left y coordinate
+             * @param w Width of area
+             * @param h Height of area
+             * @return true if the area is hidden by clipping, false otherwise
+             */
+            bool clipped(const int x, const int y, const int w, const int h);
+
             /**
              * @brief Reset the clipping area for rendered objects
              */
@@ -283,20 +1304,78 @@ namespace Aether {
              */
             std::tuple<std::vector<std::string>, int, int> calculateWrappedTextDimensions(const std::string & str, const unsigned int size, const unsigned int width);
 
+            /**
+             * @brief Returns the pixel data stored in the passed surface, packed as RGBA32
+             * (four bytes per pixel, rows from top to bottom).
+             * @param surface Surface to read
+             * @return Pixels stored in surface, or an empty vector on an error.
+             */
+            std::vector<uint8_t> readSurfaceBytes(SDL_Surface * surface);
+
+            /**
+             * @brief Returns the pixel data stored in the passed texture, packed as RGBA32
+             * (four bytes per pixel, rows from top to bottom).
+             * @note This waits for the GPU, so avoid calling it every frame.
+             * @param texture Texture to read
+             * @return Pixels stored in texture, or an empty vector on an error.
+             */
+            std::vector<uint8_t> readTextureBytes(SDL_Texture * texture);
+
             /**
              * @brief Returns the RGBA pixel data stored in the passed surface.
+             * @note Prefer \ref readSurfaceBytes(), which avoids forming a Colour per pixel.
              * @param surface Surface to read
              * @return Pixels stored in surface.
              */
             std::vector<Colour> readSurfacePixels(SDL_Surface * surface);
 
             /**
-             * @brief Returns the RGBA pixel data stored in the passed surface.
+             * @brief Returns the RGBA pixel data stored in the passed texture.
+             * @note Prefer \ref readTextureBytes(), which avoids forming a Colour per pixel.
              * @param texture Texture to read
-             * @return Pixels stored in surface.
+             * @return Pixels stored in texture.
              */
             std::vector<Colour> readTexturePixels(SDL_Texture * texture);
 
+            /**
+             * @brief Read back the most recently presented frame at the resolution it was rendered at.
+             * @note This is only possible when frames are drawn offscreen, i.e. when headless, tracking damage
+             * or rendering at a different scale.
+             *
+             * @return Image of the frame, which is invalid if it couldn't be read
+             */
+            ImageData readFrame();
+
+            /**
+             * @brief Save the next presented frame as a PNG. Encoding happens on the thread pool.
+             *
+             * @param path Path to write image to
+             */
+            void saveScreenshot(const std::string & path);
+
+            /**
+             * @brief Start writing every presented frame to the given directory, named by frame number.
+             * Frames are read back when presented and encoded on the thread pool. If encoding falls
+             * behind, frames are skipped rather than slowing down rendering.
+             *
+             * @param directory Existing directory to write frames to
+             * @param format Format to write frames in
+             * @return true if capture started, false otherwise
+             */
+            bool startCapture(const std::string & directory, const CaptureFormat format);
+
+            /**
+             * @brief Stop capturing frames, waiting for queued frames to be written.
+             */
+            void stopCapture();
+
+            /**
+             * @brief Returns whether frames are being captured.
+             *
+             * @return true if capturing, false otherwise
+             */
+            bool capturing();
+
             /**
              * @brief Render the image at the specified path as a surface
              * @note Supports PNG, JPEG and BMP.
@@ -338,6 +1417,65 @@ namespace Aether {
              */
             Drawable * renderWrappedTextSurface(const std::string str, const unsigned int size, const unsigned int width);
 
+            /**
+             * @brief Render an ellipse as a surface
+             *
+             * @param rx Radius along x dimension
+             * @param ry Radius along y dimension
+             * @param thick Thickness of outline
+             * @return Drawable containing either the rendered ellipse as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderEllipseSurface(const unsigned int rx, const unsigned int ry, const unsigned int thick);
+
+            /**
+             * @brief Render a filled ellipse as a surface
+             *
+             * @param rx Radius along x dimension
+             * @param ry Radius along y dimension
+             * @return Drawable containing either the rendered ellipse as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderFilledEllipseSurface(const unsigned int rx, const unsigned int ry);
+
+            /**
+             * @brief Render a rectangle (outline) as a surface
+             *
+             * @param width Width of rectangle
+             * @param height Height of rectangle
+             * @param thick Thickness of outline
+             * @return Drawable containing either the rendered rectangle as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderRectSurface(const int width, const int height, const unsigned int thick);
+
+            /**
+             * @brief Render a filled rectangle as a surface
+             *
+             * @param width Width of rectangle
+             * @param height Height of rectangle
+             * @return Drawable containing either the rendered rectangle as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderFilledRectSurface(const int width, const int height);
+
+            /**
+             * @brief Render a rounded rectangle (outline) as a surface
+             *
+             * @param width Width of rectangle
+             * @param height Height of rectangle
+             * @param radius Corner radius
+             * @param thick Thickness of outline
+             * @return Drawable containing either the rendered rectangle as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderRoundRectSurface(const int width, const int height, const unsigned int radius, const unsigned int thick);
+
+            /**
+             * @brief Render a filled rounded rectangle as a surface
+             *
+             * @param width Width of rectangle
+             * @param height Height of rectangle
+             * @param radius Corner radius
+             * @return Drawable containing either the rendered rectangle as a surface or nothing on an error (Type set as None).
+             */
+            Drawable * renderFilledRoundRectSurface(const int width, const int height, const unsigned int radius);
+
             /**
              * @brief Render an ellipse as a texture
              *
@@ -39,9 +39,10 @@ namespace Aether {
             bool run();
 
             /**
-             * @brief Destroys the Job object.
+             * @brief Destroys the Job object. Jobs are deleted through this
+             * base class, so derived destructors are always run.
              */
-            ~Job();
+            virtual ~Job();
     };
 };
 
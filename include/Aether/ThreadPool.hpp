@@ -120,6 +120,14 @@ namespace Aether {
              * @param id ID of job to wait for
              */
             void removeOrWaitForJob(int id);
+
+            /**
+             * @brief Removes the requested job from the queue if it hasn't started yet. Never blocks.
+             *
+             * @param id ID of job to remove
+             * @return true if the job was removed, false if it's running, finished or not found
+             */
+            bool removeJob(int id);
     };
 };
 
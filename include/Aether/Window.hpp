@@ -58,11 +58,29 @@ namespace Aether {
             double lastMillis;                                                  /** @brief Timestamp of last frame */
             bool shouldLoop;                                                    /** @brief Whether the window loop should continue */
             bool showDebug;                                                     /** @brief Whether to show the debug overlay */
+
+            /**
+             * @brief Area covered by the debug overlay when last drawn
+             */
+            struct DebugArea {
+                int x;                                                          /** @brief Left edge of overlay */
+                int y;                                                          /** @brief Top edge of overlay */
+                int w;                                                          /** @brief Width of overlay (0 if not drawn) */
+                int h;                                                          /** @brief Height of overlay (0 if not drawn) */
+            } debugArea;
+
+            bool idleMode;                                                      /** @brief Whether to wait for events when nothing is changing */
+            int idleTimeout;                                                    /** @brief Maximum time (in ms) to wait for when idle */
             Timer * timer;                                                      /** @brief Timer measuring runtime of program */
+            double fixedTimestep;                                               /** @brief Time (in ms) each frame advances by, or 0 to follow the clock */
 
             Colour bgColour;                                                    /** @brief Colour to clear screen with */
             Drawable * bgDrawable;                                              /** @brief Image to clear screen with */
 
+            bool freezeScreen;                                                  /** @brief Whether the screen is frozen while overlays are shown */
+            Drawable * snapshot;                                                /** @brief Image of the screen drawn while frozen */
+            bool snapshotStale;                                                 /** @brief Whether the snapshot needs to be retaken */
+
             Button heldButton;                                                  /** @brief Button currently held */
             int heldTime;                                                       /** @brief Time (in ms) current button has been held for */
             int holdDelay_;                                                     /** @brief Time to wait before considering a press a hold */
@@ -79,11 +97,23 @@ namespace Aether {
              */
             void performScreenOps();
 
+            /**
+             * @brief Returns whether nothing is changing, and thus the loop can wait for an event.
+             *
+             * @return true if idle, false otherwise
+             */
+            bool isIdle();
+
             /**
              * @brief Process SDL events
              */
             void processEvents();
 
+            /**
+             * @brief Render the background and current screen
+             */
+            void renderScreen();
+
             /**
              * @brief Render debug information
              *
@@ -122,8 +152,12 @@ namespace Aether {
              * @param width Width of window (optional)
              * @param height Height of window (optional)
              * @param log Handler to log messages (optional)
+             * @param mode How frames are paced (optional, defaults to vsync)
+             * @param driver Render driver to use, or "fastest" to pick by benchmark (optional, see \ref Renderer::initialize())
+             * @param headless Whether to run without a display, drawing into memory (optional). Frames then
+             * advance by a fixed timestep, see \ref setFixedTimestep()
              */
-            Window(const std::string & name, const unsigned int width, const unsigned int height, const LogHandler & log);
+            Window(const std::string & name, const unsigned int width, const unsigned int height, const LogHandler & log, const PresentMode mode = PresentMode::VSync, const std::string & driver = "", const bool headless = false);
 
             /**
              * @brief Set whether debugging information is shown.
@@ -132,6 +166,173 @@ namespace Aether {
              */
             void showDebugInfo(const bool show);
 
+            /**
+             * @brief Set whether only areas of the window that have changed are redrawn each frame.
+             * Elements report their changes automatically, however custom elements which change
+             * their appearance without using Element's methods must call \ref Element::invalidate().
+             * @note Disabled by default.
+             *
+             * @param enable Whether to enable damage tracking
+             * @return Whether damage tracking was successfully changed
+             */
+            bool setDamageTracking(const bool enable);
+
+            /**
+             * @brief Set whether the window waits for input instead of drawing frames while
+             * nothing is changing. A frame is still drawn at least once every timeout so screens
+             * which poll in their update() keep working.
+             * @note Time spent waiting is not passed to update(), as nothing was changing during it.
+             *
+             * @param enable Whether to enable idle mode
+             * @param timeout Maximum time to wait (in ms) before drawing a frame anyway
+             */
+            void setIdleMode(const bool enable, const int timeout = 1000);
+
+            /**
+             * @brief Set whether the screen is frozen while an overlay is shown. When enabled the screen
+             * is captured once as the first overlay opens, and then is neither updated nor rendered
+             * (with the captured image drawn instead) until all overlays are closed.
+             * @note Disabled by default.
+             *
+             * @param freeze Whether to freeze the screen behind overlays
+             */
+            void setFreezeBehindOverlays(const bool freeze);
+
+            /**
+             * @brief Set how frames are paced. Uncapped presents frames as fast as possible, which
+             * is useful for measuring performance.
+             *
+             * @param mode Present mode to use
+             * @param fps Frame rate to limit to (only used with PresentMode::Limited)
+             * @return Whether the mode was successfully changed
+             */
+            bool setPresentMode(const PresentMode mode, const unsigned int fps = 60);
+
+            /**
+             * @brief Set the size of the area that screens and overlays are laid out in. This is
+             * stretched to fill the window, with touch input mapped back onto it.
+             * @note Defaults to the size of the window.
+             *
+             * @param width Logical width
+             * @param height Logical height
+             * @return Whether the size was successfully changed
+             */
+            bool setLogicalSize(const unsigned int width, const unsigned int height);
+
+            /**
+             * @brief Set how many bytes of asynchronously rendered images/text may be uploaded to
+             * the GPU each frame. Anything over the budget is uploaded in following frames.
+             * @note Defaults to 4MB.
+             *
+             * @param bytes Maximum bytes per frame, or 0 for no limit
+             */
+            void setUploadBudget(const size_t bytes);
+
+            /**
+             * @brief Set how many bytes of released textures are kept to be reused by new textures of
+             * the same size and format. This avoids driver allocations when elements are repeatedly
+             * created and destroyed, such as when scrolling quickly through long lists.
+             * @note Defaults to 8MB.
+             *
+             * @param bytes Maximum bytes of idle textures, or 0 to disable pooling
+             */
+            void setTexturePoolLimit(const size_t bytes);
+
+            /**
+             * @brief Set the size of the shared textures that small images (such as icons) are packed
+             * into, so a screen of many images needs only a handful of textures.
+             * @note Defaults to 1024x1024. Only affects images rendered afterwards.
+             *
+             * @param size Width and height of each atlas page, or 0 to give every image it's own texture
+             */
+            void setTextureAtlasSize(const unsigned int size);
+
+            /**
+             * @brief Set a ceiling on the memory used by surfaces and textures. When exceeded, the textures of
+             * elements which haven't been drawn recently (e.g. on screens further down the stack) are destroyed,
+             * least recently drawn first, and are rendered again when they're next drawn.
+             * @note Disabled by default.
+             *
+             * @param bytes Maximum bytes of surfaces/textures, or 0 for no limit
+             */
+            void setTextureBudget(const size_t bytes);
+
+            /**
+             * @brief Set whether textures are stored in 16-bit formats where possible, roughly halving
+             * the memory they use at the cost of some colour banding.
+             * @note Only affects textures rendered afterwards. Disabled by default.
+             *
+             * @param enable Whether to use low memory texture formats
+             */
+            void setLowMemoryTextures(const bool enable);
+
+            /**
+             * @brief Set whether each frame's draw commands are culled and batched on another thread
+             * while the next frame is updated. This lets a second core share the work of each frame,
+             * but shows frames one frame later.
+             * @note Disabled by default.
+             *
+             * @param enable Whether to pipeline rendering
+             */
+            void setPipelinedRendering(const bool enable);
+
+            /**
+             * @brief Set a fixed amount of time that passes between each frame, instead of measuring it.
+             * This makes animations and updates repeatable regardless of how long frames take.
+             * @note Defaults to 60 frames per second when headless, otherwise disabled.
+             *
+             * @param millis Milliseconds each frame advances by, or 0 to use the real time
+             */
+            void setFixedTimestep(const double millis);
+
+            /**
+             * @brief Read back the most recently presented frame. Only possible when headless, tracking
+             * damage or rendering at a different scale (see \ref Renderer::readFrame()).
+             *
+             * @return Image of the frame, which is invalid if it couldn't be read
+             */
+            ImageData readFrame();
+
+            /**
+             * @brief Returns measurements of the most recently presented frame, such as how long it
+             * took and the number of textures alive.
+             *
+             * @return Statistics of the last frame
+             */
+            FrameStats frameStats();
+
+            /**
+             * @brief Save the next presented frame as a PNG. The image is written on another thread.
+             *
+             * @param path Path to write the screenshot to
+             */
+            void saveScreenshot(const std::string & path);
+
+            /**
+             * @brief Start writing every presented frame to the given (existing) directory. Frames are
+             * encoded and written on other threads, and are skipped if writing falls behind.
+             *
+             * @param directory Directory to write frames into
+             * @param format Format to write frames in
+             * @return Whether capturing was started
+             */
+            bool startCapture(const std::string & directory, const CaptureFormat format = CaptureFormat::PNG);
+
+            /**
+             * @brief Stop capturing frames, waiting for any captured frames to be written.
+             */
+            void stopCapture();
+
+            /**
+             * @brief Set the resolution frames are rendered at relative to the logical size, before
+             * being scaled to fit the window. Values below 1 trade sharpness for GPU time.
+             * @note Defaults to 1.
+             *
+             * @param scale Render scale factor
+             * @return Whether the scale was successfully changed
+             */
+            bool setRenderScale(const float scale);
+
             /**
              * @brief Enable a fade in animation.
              *
@@ -46,6 +46,14 @@ namespace Aether {
             bool selected_;
             /** @brief Indicator on whether element is touch responsive */
             bool touchable_;
+            /** @brief Indicator on whether the element and it's children are drawn via a cached layer */
+            bool cacheAsLayer_;
+            /** @brief Cached rendering of the element and it's children */
+            Drawable * layer;
+            /** @brief Indicator on whether the cached layer needs to be redrawn */
+            bool layerDirty;
+            /** @brief Value of layerGeneration when the cached layer was last drawn */
+            unsigned int layerDrawnGeneration;
 
             /** @brief Element which "owns" the cached highlight textures */
             static Element * hiOwner;
@@ -77,6 +85,8 @@ namespace Aether {
 
             /** @brief Indicator on whether the touch is "active" (i.e. hide highlighting) or not */
             static bool isTouch;
+            /** @brief Incremented whenever a change affects how every element looks (invalidating all layers) */
+            static unsigned int layerGeneration;
             /** @brief Pointer to parent element, if there is one */
             Element * parent_;
             /** @brief Vector of child elements (used to call their methods) */
@@ -93,6 +103,14 @@ namespace Aether {
              */
              void addElementAt(Element * e, size_t i);
 
+            /**
+             * @brief Record that the element and it's (visible) children were shown in the given frame
+             * without being rendered, such as when drawn from a cached layer.
+             *
+             * @param frame Number of the frame they were shown in
+             */
+            virtual void markDrawn(const unsigned int frame);
+
         public:
             /**
              * @brief Construct a new Element object.
@@ -250,6 +268,45 @@ namespace Aether {
              */
             bool isVisible();
 
+            /**
+             * @brief Mark the area covered by this element (including it's highlight) as needing
+             * to be redrawn. Element's methods call this whenever they change how the element looks,
+             * but subclasses which change their appearance in other ways should call it themselves.
+             * @note This has no effect unless damage tracking is enabled (see \ref Window::setDamageTracking()).
+             */
+            void invalidate();
+
+            /**
+             * @brief Request that another frame is drawn after the current one. Elements which
+             * animate without otherwise changing (e.g. waiting on a timer) should call this on
+             * every update so the window doesn't go idle.
+             */
+            void requestFrame();
+
+            /**
+             * @brief Set whether the element and all of it's children are drawn once onto an offscreen
+             * texture, which is then drawn as a single quad until something inside changes.
+             * Useful for complex elements that rarely change.
+             * @note Anything drawn outside of the element's bounds (and highlight border) is cut off.
+             *
+             * @param cache Whether to cache the element as a layer
+             */
+            void setCacheAsLayer(const bool cache);
+
+            /**
+             * @brief Returns whether the element is cached as a layer.
+             *
+             * @return true if cached as a layer, false otherwise
+             */
+            bool cacheAsLayer();
+
+            /**
+             * @brief Render the element, either by calling \ref render() or by drawing it's
+             * cached layer (see \ref setCacheAsLayer()). Parents should call this on their children
+             * rather than \ref render().
+             */
+            void draw();
+
             /**
              * @brief Check if current element is hidden
              *
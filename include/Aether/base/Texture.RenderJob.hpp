@@ -6,15 +6,27 @@
 
 namespace Aether {
     /**
-     * @brief Extends a thread pool job to render the given texture element
-     * on a separate thread.
+     * @brief Extends a thread pool job to render a texture element on a
+     * separate thread. Unless the element's render function calls back into
+     * it, the job doesn't touch the element itself, so the element can be
+     * deleted without waiting for it.
      */
     class Texture::RenderJob : public ThreadPool::Job {
         private:
             /**
-             * @brief Texture object to operate on.
+             * @brief Function rendering the texture (see \ref Texture::renderFunction()).
              */
-            Texture * texture;
+            std::function<Drawable * ()> func;
+
+            /**
+             * @brief State shared with the texture, which receives the result.
+             */
+            std::shared_ptr<AsyncState> state;
+
+            /**
+             * @brief Renderer to wake up once the result is ready, or to delete an unwanted result.
+             */
+            Renderer * renderer;
 
             /**
              * @brief Implements \ref ThreadPool::Job::work() to render the texture.
@@ -25,9 +37,11 @@ namespace Aether {
             /**
              * @brief Constructs a new Render job.
              *
-             * @param texture Texture to operate on
+             * @param func Function rendering the texture
+             * @param state State shared with the texture
+             * @param renderer Renderer to wake up once the result is ready, or to delete an unwanted result
              */
-            RenderJob(Texture * texture);
+            RenderJob(const std::function<Drawable * ()> & func, const std::shared_ptr<AsyncState> & state, Renderer * renderer);
     };
 };
 
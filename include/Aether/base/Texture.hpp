@@ -3,6 +3,9 @@
 
 #include "Aether/base/Element.hpp"
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
 
 namespace Aether {
     /**
@@ -37,25 +40,91 @@ namespace Aether {
                 Done                                /**< Everything is done; the texture can be shown */
             };
 
+            /**
+             * @brief State shared between the texture and it's async task, which outlives
+             * whichever of the two finishes last.
+             */
+            struct AsyncState {
+                std::mutex mtx;                     /** @brief Mutex protecting the other members */
+                bool abandoned;                     /** @brief Whether the texture no longer wants the result */
+                Drawable * result;                  /** @brief Rendered drawable waiting to be taken by the texture */
+            };
+
             int asyncID;                            /** @brief ID of async task */
+            std::shared_ptr<AsyncState> asyncState; /** @brief State shared with the current async task */
+            bool asyncCallsElement;                 /** @brief Whether the current async task calls \ref renderDrawable() */
             std::function<void()> onRenderDoneFunc; /** @brief Function to invoke when rendering is complete */
             std::atomic<AsyncStatus> status;        /** @brief Current status of texture */
 
             Colour colour_;                         /** @brief Colour to tint texture with */
+            TextureFormat format_;                  /** @brief Pixel format to store the texture in */
             Drawable * drawable;                    /** @brief The texture to draw on screen */
             Drawable * tmpDrawable;                 /** @brief Pointer temporarily storing rendered drawable */
 
+            static std::unordered_set<Texture *> instances;    /** @brief Every texture element, which may be evicted */
+            unsigned int lastDrawn;                 /** @brief Frame the texture was last drawn in */
+            bool renderedAsync;                     /** @brief Whether the texture was last rendered asynchronously */
+            bool evicted;                           /** @brief Whether the texture was destroyed to free memory */
+            bool restoring;                         /** @brief Whether the texture is being rendered again after eviction */
+
+            bool hasMask;                           /** @brief Whether a mask was set on the current texture */
+            int maskX;                              /** @brief X coordinate of mask */
+            int maskY;                              /** @brief Y coordinate of mask */
+            unsigned int maskW;                     /** @brief Width of mask */
+            unsigned int maskH;                     /** @brief Height of mask */
+            bool hasTextureSize;                    /** @brief Whether a nine-slice size was set since the texture was destroyed */
+            unsigned int textureW;                  /** @brief Laid out width of nine-slice */
+            unsigned int textureH;                  /** @brief Laid out height of nine-slice */
+
+            /**
+             * @brief Destroy the stored texture to free memory, without redrawing. It's rendered again when next drawn.
+             */
+            void evict();
+
             /**
              * @brief Small helper to set up a new drawable.
              */
             void setupDrawable();
 
+            /**
+             * @brief Stop waiting for the current async task (if any). A queued task is removed, while
+             * a running task is left to finish and discard it's result.
+             */
+            void abandonAsync();
+
         protected:
             /**
              * @brief Method provided by children defining how to render the texture.
              */
             virtual Drawable * renderDrawable() = 0;
 
+            /**
+             * @brief Returns a function which renders the texture on another thread. By default this calls
+             * \ref renderDrawable(), so deleting the texture waits for a running task to finish.
+             * @note Children can override this to not wait, by returning a function which captures copies of
+             * everything it reads instead of the element itself.
+             *
+             * @return Function rendering the texture
+             */
+            virtual std::function<Drawable * ()> renderFunction();
+
+            /**
+             * @brief Overrides \ref Element::markDrawn() to keep the texture from being evicted.
+             *
+             * @param frame Number of the frame it was shown in
+             */
+            void markDrawn(const unsigned int frame);
+
+            /**
+             * @brief Set the size a nine-slice texture is laid out at (see \ref Drawable::setNineSlice()),
+             * without having to render it again. Also applies to a texture still being rendered, and has
+             * no effect on other textures.
+             *
+             * @param w New width in pixels
+             * @param h New height in pixels
+             */
+            void setTextureSize(const unsigned int w, const unsigned int h);
+
         public:
             /**
              * @brief Constructs a new texture element. Position defaults to (0, 0).
@@ -87,6 +156,15 @@ namespace Aether {
              */
             void setColour(const Colour & col);
 
+            /**
+             * @brief Set the pixel format the texture is stored in, e.g. TextureFormat::Compact for
+             * large textures which don't need full colour precision.
+             * @note Only takes effect the next time the texture is rendered.
+             *
+             * @param format Texture format to use
+             */
+            void setTextureFormat(const TextureFormat format);
+
             /**
              * @brief Returns the width of the stored texture. Returns 0 if the texture
              * is being rendered asynchronously and isn't finished.
@@ -118,7 +196,7 @@ namespace Aether {
 
             /**
              * @brief Destroy the stored texture, freeing memory. Safe to call even if no texture is stored.
-             * @note This will block if the texture isn't finished rendering.
+             * @note This doesn't wait for a texture that is being rendered; it's result is discarded once finished.
              */
             void destroy();
 
@@ -157,8 +235,16 @@ namespace Aether {
              */
             void render();
 
+            /**
+             * @brief Called internally. Destroys the textures of elements that haven't been drawn recently,
+             * least recently drawn first, until enough memory is freed to be within the renderer's texture
+             * budget (see \ref Renderer::setTextureBudget()). Nothing drawn in the last frame is evicted.
+             */
+            static void enforceTextureBudget();
+
             /**
              * @brief Destroys the texture, freeing all allocated memory.
+             * @note This doesn't wait for a task still rendering the texture; it's result is discarded once finished.
              */
             ~Texture();
     };
@@ -6,7 +6,6 @@
 namespace Aether {
     /**
      * @brief Element for rendering a 'box' (rectangle with no fill).
-     * @note This element can not be drawn asynchronously!
      */
     class Box : public Texture {
         private:
@@ -18,6 +17,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the box, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
         public:
             /**
              * @brief Constructs a new Box element.
@@ -28,8 +32,9 @@ namespace Aether {
              * @param h Height of box
              * @param thick Border thickness (optional)
              * @param radius Border corner radius (optional)
+             * @param type \ref Render Type of rendering to perform
              */
-            Box(const int x, const int y, const int w, const int h, const unsigned int thick = 1, const unsigned int radius = 0);
+            Box(const int x, const int y, const int w, const int h, const unsigned int thick = 1, const unsigned int radius = 0, const Render type = Render::Sync);
 
             /**
              * @brief Returns the thickness of the border
@@ -0,0 +1,142 @@
+#ifndef AETHER_CANVAS_HPP
+#define AETHER_CANVAS_HPP
+
+#include "Aether/base/Element.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Aether {
+    /**
+     * @brief A canvas is an element whose pixels are drawn on by the CPU, for content
+     * that changes every frame (e.g. graphs). Drawing happens on a copy of the pixels in
+     * memory, and only the areas that changed are uploaded when the canvas is rendered.
+     * @note The canvas is stretched to fill the element's size.
+     */
+    class Canvas : public Element {
+        private:
+            /**
+             * @brief An area of the canvas which needs uploading
+             */
+            struct DirtyRect {
+                int x;                              /** @brief X coordinate of area (top-left) */
+                int y;                              /** @brief Y coordinate of area (top-left) */
+                int w;                              /** @brief Width of area */
+                int h;                              /** @brief Height of area */
+            };
+
+            unsigned int canvasWidth_;              /** @brief Width of canvas (in pixels) */
+            unsigned int canvasHeight_;             /** @brief Height of canvas (in pixels) */
+            std::vector<uint32_t> buffer;           /** @brief Pixels of canvas in RGBA32 format */
+            std::vector<DirtyRect> dirty;           /** @brief Areas changed since the texture was last updated */
+            Drawable * drawable;                    /** @brief Streaming texture the pixels are uploaded to */
+
+            /**
+             * @brief Convert a colour into a pixel in the buffer's format.
+             *
+             * @param col Colour to convert
+             * @return Pixel value
+             */
+            static uint32_t toPixel(const Colour & col);
+
+        public:
+            /**
+             * @brief Constructs a new Canvas element, initially transparent.
+             *
+             * @param x Top-left x coordinate
+             * @param y Top-left y coordinate
+             * @param w Width of canvas (in pixels)
+             * @param h Height of canvas (in pixels)
+             */
+            Canvas(const int x, const int y, const unsigned int w, const unsigned int h);
+
+            /**
+             * @brief Returns the width of the canvas' pixel buffer.
+             *
+             * @return Width in pixels
+             */
+            unsigned int canvasWidth();
+
+            /**
+             * @brief Returns the height of the canvas' pixel buffer.
+             *
+             * @return Height in pixels
+             */
+            unsigned int canvasHeight();
+
+            /**
+             * @brief Fill the whole canvas with a colour.
+             *
+             * @param col Colour to fill with
+             */
+            void clear(const Colour & col);
+
+            /**
+             * @brief Set the colour of one pixel. Does nothing if the pixel is outside of the canvas.
+             *
+             * @param x X coordinate of pixel
+             * @param y Y coordinate of pixel
+             * @param col New colour of pixel
+             */
+            void setPixel(const int x, const int y, const Colour & col);
+
+            /**
+             * @brief Fill a rectangle with a colour (replacing what was there). The rectangle is
+             * clipped to the canvas.
+             *
+             * @param x X coordinate of rectangle (top-left)
+             * @param y Y coordinate of rectangle (top-left)
+             * @param w Width of rectangle
+             * @param h Height of rectangle
+             * @param col Colour to fill with
+             */
+            void fillRect(const int x, const int y, const int w, const int h, const Colour & col);
+
+            /**
+             * @brief Draw a one pixel wide line between two points (inclusive).
+             *
+             * @param x1 X coordinate of first point
+             * @param y1 Y coordinate of first point
+             * @param x2 X coordinate of second point
+             * @param y2 Y coordinate of second point
+             * @param col Colour of line
+             */
+            void drawLine(const int x1, const int y1, const int x2, const int y2, const Colour & col);
+
+            /**
+             * @brief Returns the canvas' pixel buffer (in RGBA32 format) for drawing directly.
+             * @note \ref markDirty() must be called with any area that's changed.
+             *
+             * @return Pointer to first pixel
+             */
+            uint8_t * pixels();
+
+            /**
+             * @brief Returns the number of bytes in one row of the pixel buffer.
+             *
+             * @return Pitch of pixel buffer
+             */
+            size_t pitch();
+
+            /**
+             * @brief Mark an area of the canvas as changed so it's uploaded when next rendered.
+             *
+             * @param x X coordinate of area (top-left)
+             * @param y Y coordinate of area (top-left)
+             * @param w Width of area
+             * @param h Height of area
+             */
+            void markDirty(const int x, const int y, const int w, const int h);
+
+            /**
+             * @brief Uploads any changed areas and renders the canvas.
+             */
+            void render();
+
+            /**
+             * @brief Destroys the canvas.
+             */
+            ~Canvas();
+    };
+};
+
+#endif
@@ -6,7 +6,6 @@
 namespace Aether {
     /**
      * @brief Element for rendering an ellipse.
-     * @note This element can not be drawn asynchronously!
      */
     class Ellipse : public Texture {
         private:
@@ -18,6 +17,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the ellipse, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
         public:
             /**
              * @brief Constructs a new Ellipse element. Creates a circle if
@@ -27,8 +31,9 @@ namespace Aether {
              * @param y Top-left y coordinate
              * @param xd Horizontal diameter in pixels
              * @param yd Vertical diameter in pixels (optional)
+             * @param type \ref Render Type of rendering to perform
              */
-            Ellipse(const int x, const int y, const unsigned int xd, const unsigned int yd = 0);
+            Ellipse(const int x, const int y, const unsigned int xd, const unsigned int yd = 0, const Render type = Render::Sync);
 
             /**
              * @brief Returns the ellipse's horizontal diameter
@@ -27,7 +27,7 @@ namespace Aether {
                 unsigned char * ptr;
                 size_t size;
             } mem;
-            std::vector<unsigned char> copy;    /** @brief Copy of image data */
+            std::shared_ptr<const std::vector<unsigned char>> copy;     /** @brief Copy of image data, shared with render tasks */
             std::string path;                   /** @brief Path to image file */
             Type type;                          /** @brief Type of image */
 
@@ -39,6 +39,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the image, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
             /**
              * @brief Small helper to render based on passed type.
              *
@@ -6,7 +6,7 @@
 namespace Aether {
     /**
      * @brief A rectangle is a texture containing either a normal or rounded rectangle.
-     * @note This element can not be drawn asynchronously!
+     * @note Square rectangles are drawn as a solid fill, and don't need a texture.
      */
     class Rectangle : public Texture {
         private:
@@ -18,6 +18,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the rectangle, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
         public:
             /**
              * @brief Constructs a new Rectangle element.
@@ -27,8 +32,9 @@ namespace Aether {
              * @param w Width of rectangle
              * @param h Height of rectangle
              * @param radius Corner radius (optional)
+             * @param type \ref Render Type of rendering to perform
              */
-            Rectangle(const int x, const int y, const int w, const int h, const unsigned int radius = 0);
+            Rectangle(const int x, const int y, const int w, const int h, const unsigned int radius = 0, const Render type = Render::Sync);
 
             /**
              * @brief Returns the corner radius of the rectangle
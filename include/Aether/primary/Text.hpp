@@ -30,6 +30,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the line of text, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
         public:
             /**
              * @brief Constructs a new Text element.
@@ -17,6 +17,11 @@ namespace Aether {
              */
             Drawable * renderDrawable();
 
+            /**
+             * @brief Captures what's needed to render the block of text, so it can be rendered on another thread.
+             */
+            std::function<Drawable * ()> renderFunction();
+
         public:
             /**
              * @brief Constructs a new TextBlock element.
@@ -20,6 +20,9 @@ namespace Aether {
      * @note All instances of this should be deleted before deleting the main renderer.
      */
     class Drawable {
+        // Allow the renderer to draw onto layers
+        friend Renderer;
+
         public:
             /**
             * @brief Type of raw data stored
@@ -27,7 +30,8 @@ namespace Aether {
             enum class Type {
                 None,                       /**< Doesn't store any data that can be rendered */
                 Surface,                    /**< Currently stores a SDL 'surface' */
-                Texture                     /**< Currently stores a SDL 'texture' */
+                Texture,                    /**< Currently stores a SDL 'texture' */
+                Fill                        /**< Doesn't store any data, but draws a solid rectangle */
             };
 
         private:
@@ -42,6 +46,7 @@ namespace Aether {
             Colour colour_;                 /** @brief Colour to tint with */
             Renderer * renderer;            /** @brief Renderer object */
             Type type_;                     /** @brief Type of stored data */
+            TextureFormat format_;          /** @brief Format to use when converted to a texture */
 
             unsigned int width_;            /** @brief Width of image (in pixels) */
             unsigned int height_;           /** @brief Height of image (in pixels) */
@@ -51,6 +56,26 @@ namespace Aether {
             int maskW;                      /** @brief Width of mask */
             int maskH;                      /** @brief Height of mask */
 
+            bool nineSlice_;                /** @brief Whether the Drawable is stretched as a nine-slice */
+            unsigned int sliceInset;        /** @brief Size of each corner when drawn as a nine-slice */
+            unsigned int srcWidth;          /** @brief Width of stored data when drawn as a nine-slice */
+            unsigned int srcHeight;         /** @brief Height of stored data when drawn as a nine-slice */
+
+            bool atlas_;                    /** @brief Whether the surface may be packed into a shared atlas texture */
+            bool packed;                    /** @brief Whether the texture is an atlas page shared with other images */
+            int originX;                    /** @brief X coordinate of the image within it's texture */
+            int originY;                    /** @brief Y coordinate of the image within it's texture */
+
+            /**
+             * @brief Render the Drawable as a nine-slice, laid out at it's current size.
+             *
+             * @param x X coordinate (top-left)
+             * @param y Y coordinate (top-left)
+             * @param width Width to render the masked area at
+             * @param height Height to render the masked area at
+             */
+            void renderNineSlice(const int x, const int y, const unsigned int width, const unsigned int height);
+
         public:
             /**
              * @brief Default constructor. Initializes with no data.
@@ -78,6 +103,16 @@ namespace Aether {
              */
             Drawable(Renderer * renderer, SDL_Texture * tex, const unsigned int width, const unsigned int height);
 
+            /**
+             * @brief Create a Drawable which fills it's area with it's colour, without
+             * needing a texture.
+             *
+             * @param renderer Renderer to draw Drawable with
+             * @param width Width of filled area (in pixels)
+             * @param height Height of filled area (in pixels)
+             */
+            Drawable(Renderer * renderer, const unsigned int width, const unsigned int height);
+
             /**
              * @brief Returns the \ref ImageData for the currently stored image.
              * @return ImageData for the currently stored image.
@@ -101,6 +136,34 @@ namespace Aether {
              */
             void setMask(const int x, const int y, const unsigned int width, const unsigned int height);
 
+            /**
+             * @brief Draw the Drawable as a 'nine-slice'. The corners (each inset x inset pixels)
+             * are drawn unscaled, while the edges and centre are stretched to fill the size set with
+             * \ref setSize(). This allows a small texture to be drawn at any size without re-rendering.
+             * @note The mask is reset, and is afterwards interpreted relative to the laid out size.
+             *
+             * @param inset Size of each corner in pixels
+             */
+            void setNineSlice(const unsigned int inset);
+
+            /**
+             * @brief Returns whether the Drawable is drawn as a nine-slice.
+             *
+             * @return true if drawn as a nine-slice, false otherwise
+             */
+            bool nineSlice();
+
+            /**
+             * @brief Set the size a nine-slice Drawable is laid out at, which is also
+             * the size returned by \ref width() and \ref height(). Has no effect if
+             * the Drawable isn't a nine-slice or a fill.
+             * @note The mask is reset to cover the new size.
+             *
+             * @param width New width in pixels
+             * @param height New height in pixels
+             */
+            void setSize(const unsigned int width, const unsigned int height);
+
             /**
              * @brief Render the Drawable on screen at the given coordinates
              *
@@ -120,6 +183,29 @@ namespace Aether {
              */
             bool convertToTexture();
 
+            /**
+             * @brief Set whether the contained surface may be packed into a texture shared with other small
+             * images when converted by \ref convertToTexture(), which saves a texture per image. Only images
+             * using TextureFormat::Auto which are small enough are packed (see \ref Renderer::setAtlasPageSize()).
+             *
+             * @param atlas Whether the surface may be packed into an atlas
+             */
+            void setAtlas(const bool atlas);
+
+            /**
+             * @brief Set the pixel format the contained surface is converted to by \ref convertToTexture().
+             *
+             * @param format Texture format to convert to
+             */
+            void setFormat(const TextureFormat format);
+
+            /**
+             * @brief Returns the pixel format the contained surface is converted to.
+             *
+             * @return Texture format to convert to
+             */
+            TextureFormat format();
+
             /**
              * @brief Returns the type of the data stored
              *
@@ -141,6 +227,20 @@ namespace Aether {
              */
             int height();
 
+            /**
+             * @brief Returns the number of bytes that will be uploaded when converting to a texture.
+             *
+             * @return Size of stored surface in bytes, 0 if no surface stored
+             */
+            size_t surfaceSize();
+
+            /**
+             * @brief Returns the number of bytes that would be freed by destroying the stored texture.
+             *
+             * @return Size of stored texture in bytes, 0 if no texture is stored or it's shared with other images
+             */
+            size_t textureSize();
+
             /**
              * @brief Destructor ensures contained data is deleted appropriately
              */
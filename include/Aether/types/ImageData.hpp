@@ -98,6 +98,15 @@ namespace Aether {
              * @return Vector of image pixels.
              */
             std::vector<Colour> toColourVector() const;
+
+            /**
+             * @brief Compares the stored image against another, pixel by pixel.
+             *
+             * @param other Image to compare against
+             * @param tolerance Largest difference allowed in any channel for pixels to be considered equal
+             * @return Number of pixels which differ, or the larger image's pixel count if the sizes differ
+             */
+            size_t countDifferences(const ImageData & other, const uint8_t tolerance = 0) const;
     };
 };
 
@@ -0,0 +1,38 @@
+#ifndef AETHER_UTILS_RASTERIZER_HPP
+#define AETHER_UTILS_RASTERIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+// Anti-aliased shape rasterization straight into a pixel buffer. These functions
+// don't touch SDL and are safe to call from any thread.
+namespace Aether::Utils::Rasterizer {
+    /**
+     * @brief Clears the given RGBA32 buffer to transparent white.
+     *
+     * @param pixels Pointer to first pixel
+     * @param width Width of buffer (in pixels)
+     * @param height Height of buffer (in pixels)
+     * @param pitch Number of bytes in one row
+     */
+    void clear(uint8_t * pixels, const size_t width, const size_t height, const size_t pitch);
+
+    /**
+     * @brief Rasterizes a white (optionally rounded) rectangle filling the given RGBA32 buffer,
+     * storing the anti-aliased coverage in the alpha channel. Elliptical corners are supported
+     * by passing different radii, so an ellipse is drawn by using half of the buffer's
+     * dimensions as the radii.
+     * @note Only pixels covered by the shape are written, so the buffer should be cleared first.
+     *
+     * @param pixels Pointer to first pixel
+     * @param width Width of buffer (in pixels)
+     * @param height Height of buffer (in pixels)
+     * @param pitch Number of bytes in one row
+     * @param rx Horizontal corner radius (0 for square corners)
+     * @param ry Vertical corner radius (0 for square corners)
+     * @param thick Thickness of outline, or 0 to fill the shape
+     */
+    void drawRoundRect(uint8_t * pixels, const size_t width, const size_t height, const size_t pitch, const float rx, const float ry, const float thick);
+};
+
+#endif
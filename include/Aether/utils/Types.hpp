@@ -2,7 +2,10 @@
 #define AETHER_TYPES_HPP
 
 #include "Aether/types/Colour.hpp"
+#include <cstdint>
 #include <functional>
+#include <string>
+#include <vector>
 
 namespace Aether {
     /**
@@ -50,6 +53,60 @@ namespace Aether {
         None           /**< No padding whatsoever (item width = list width) */
     };
 
+    /**
+     * @brief Enum class for how frames are paced when presented
+     */
+    enum class PresentMode {
+        VSync,              /**< Wait for the display's vertical sync */
+        Uncapped,           /**< Present as fast as possible (useful for benchmarking) */
+        Limited             /**< Don't wait for vsync, but limit to a fixed frame rate */
+    };
+
+    /**
+     * @brief Enum class for the pixel format a surface is converted to when uploaded as a texture.
+     * Formats not supported by the backend fall back to RGBA32.
+     */
+    enum class TextureFormat {
+        Auto,               /**< Opaque images drop alpha, and everything is compacted in low memory mode */
+        Full,               /**< Always use 32-bit RGBA */
+        Opaque,             /**< Discard alpha, using 24-bit RGB (or 16-bit RGB565 in low memory mode) */
+        Compact             /**< Use 16-bit RGBA4444, which has visible banding on gradients */
+    };
+
+    /**
+     * @brief Enum class for how captured frames are written to disk
+     */
+    enum class CaptureFormat {
+        PNG,                /**< Compressed PNG images */
+        Raw                 /**< Uncompressed RGBA32 bytes (quicker to write, but much larger) */
+    };
+
+    /**
+     * @brief Capabilities of a rendering backend
+     */
+    struct RendererInfo {
+        std::string name;                       /**< Name of the SDL render driver */
+        bool accelerated;                       /**< Whether rendering is hardware accelerated */
+        bool vsync;                             /**< Whether presenting can be synced to the display */
+        bool renderTargets;                     /**< Whether textures can be rendered onto */
+        bool geometry;                          /**< Whether arbitrary geometry can be rendered */
+        unsigned int maxTextureWidth;           /**< Maximum width of a texture (0 if unlimited) */
+        unsigned int maxTextureHeight;          /**< Maximum height of a texture (0 if unlimited) */
+        std::vector<uint32_t> textureFormats;   /**< Supported SDL_PixelFormatEnum values */
+    };
+
+    /**
+     * @brief Measurements of a presented frame
+     */
+    struct FrameStats {
+        double frameTime;                       /**< Milliseconds since the previous frame was presented */
+        size_t drawCommands;                    /**< Number of draw commands submitted */
+        size_t batches;                         /**< Number of batches the commands were submitted in */
+        size_t uploadedBytes;                   /**< Bytes of surfaces converted to textures */
+        unsigned int textureCount;              /**< Number of textures alive when presented */
+        unsigned long memoryUsage;              /**< Bytes used by surfaces/textures when presented */
+    };
+
     /**
      * @brief Struct for UI Theme
      */
@@ -2,7 +2,7 @@
 #include "Aether/utils/Utils.hpp"
 
 namespace Aether {
-    InputEvent::InputEvent(SDL_Event e) {
+    InputEvent::InputEvent(SDL_Event e, const unsigned int width, const unsigned int height) {
         // Turn all directional events into dpad
         Button tmp = Utils::SDLtoButton(e.jbutton.button);
         if (e.type == SDL_JOYBUTTONDOWN || e.type == SDL_JOYBUTTONUP) {
@@ -43,8 +43,8 @@ namespace Aether {
                 this->type_ = TouchPressed;
                 this->button_ = Button::NO_BUTTON;
                 this->id_ = -1;
-                this->touchX_ = e.tfinger.x * 1280;
-                this->touchY_ = e.tfinger.y * 720;
+                this->touchX_ = e.tfinger.x * width;
+                this->touchY_ = e.tfinger.y * height;
                 this->touchDX_ = 0;
                 this->touchDY_ = 0;
                 break;
@@ -52,19 +52,19 @@ namespace Aether {
                 this->type_ = TouchMoved;
                 this->button_ = Button::NO_BUTTON;
                 this->id_ = -1;
-                this->touchX_ = e.tfinger.x * 1280;
-                this->touchY_ = e.tfinger.y * 720;
-                this->touchDX_ = e.tfinger.dx * 1280;
-                this->touchDY_ = e.tfinger.dy * 720;
+                this->touchX_ = e.tfinger.x * width;
+                this->touchY_ = e.tfinger.y * height;
+                this->touchDX_ = e.tfinger.dx * width;
+                this->touchDY_ = e.tfinger.dy * height;
                 break;
             case SDL_FINGERUP:
                 this->type_ = TouchReleased;
                 this->button_ = Button::NO_BUTTON;
                 this->id_ = -1;
-                this->touchX_ = e.tfinger.x * 1280;
-                this->touchY_ = e.tfinger.y * 720;
-                this->touchDX_ = e.tfinger.dx * 1280;
-                this->touchDY_ = e.tfinger.dy * 720;
+                this->touchX_ = e.tfinger.x * width;
+                this->touchY_ = e.tfinger.y * height;
+                this->touchDX_ = e.tfinger.dx * width;
+                this->touchDY_ = e.tfinger.dy * height;
                 break;
         }
     }
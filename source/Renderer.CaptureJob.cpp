@@ -0,0 +1,43 @@
+#include "Aether/Renderer.CaptureJob.hpp"
+#include <cstdio>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+namespace Aether {
+    Renderer::CaptureJob::CaptureJob(Renderer * renderer, std::vector<uint8_t> && pixels, const int width, const int height, const std::string & path, const CaptureFormat format) : Job() {
+        this->renderer = renderer;
+        this->pixels = std::move(pixels);
+        this->width = width;
+        this->height = height;
+        this->path = path;
+        this->format = format;
+    }
+
+    void Renderer::CaptureJob::work() {
+        bool ok = false;
+        if (this->format == CaptureFormat::Raw) {
+            FILE * file = std::fopen(this->path.c_str(), "wb");
+            if (file != nullptr) {
+                ok = (std::fwrite(this->pixels.data(), 1, this->pixels.size(), file) == this->pixels.size());
+                std::fclose(file);
+            }
+
+        } else {
+            // Wrap the pixels in a surface without copying them
+            SDL_Surface * surf = SDL_CreateRGBSurfaceWithFormatFrom(this->pixels.data(), this->width, this->height, 32, this->width * 4, SDL_PIXELFORMAT_RGBA32);
+            if (surf != nullptr) {
+                ok = (IMG_SavePNG(surf, this->path.c_str()) == 0);
+                SDL_FreeSurface(surf);
+            }
+        }
+
+        if (!ok) {
+            this->renderer->logMessage("Couldn't write captured frame to " + this->path, true);
+        }
+    }
+
+    Renderer::CaptureJob::~CaptureJob() {
+        // Count the frame as handled even if the job was dropped without running
+        this->renderer->pendingCaptures--;
+    }
+}
@@ -1,33 +1,165 @@
 #include "Aether/Renderer.hpp"
+#include "Aether/Renderer.CaptureJob.hpp"
+#include "Aether/ThreadPool.hpp"
 #include "Aether/types/Drawable.hpp"
 #include "Aether/types/ImageData.hpp"
 #include "Aether/utils/FontCache.hpp"
 #include "Aether/utils/Image.hpp"
-#include "Aether/utils/SDL2_gfx_ext.hpp"
+#include "Aether/utils/Rasterizer.hpp"
 #include "Aether/utils/Utils.hpp"
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <tuple>
 #include <SDL2/SDL.h>
-#include <SDL2/SDL2_gfxPrimitives.h>
 #include <SDL2/SDL2_rotozoom.h>
 #include <SDL2/SDL_image.h>
 #ifdef __SWITCH__
 #include <switch.h>
 #endif
 
+// Maximum number of separate damaged areas before they're combined into one
+static constexpr size_t maxDamageRects = 8;
+
+// Maximum number of opaque areas tested against when culling hidden quads
+static constexpr size_t maxOccluders = 8;
+
+// Default frame rate used by PresentMode::Limited
+static constexpr unsigned int defaultFrameLimit = 60;
+
+// Time (in ms) before a limited frame is due to stop sleeping and start spinning
+static constexpr uint64_t limiterSpinTime = 2;
+
+// Default number of bytes of surfaces converted to textures per frame
+static constexpr size_t defaultUploadBudget = 4 * 1024 * 1024;
+
+// Bytes of released textures kept for reuse by default (8MB)
+static constexpr size_t defaultTexturePoolLimit = 8 * 1024 * 1024;
+
+// Default width and height of atlas pages
+static constexpr unsigned int defaultAtlasPageSize = 1024;
+
+// Largest image (in either dimension) packed into an atlas page
+static constexpr int maxAtlasImageSize = 128;
+
+// Transparent border around each packed image, so filtering doesn't bleed between them
+static constexpr int atlasPadding = 1;
+
+// Maximum number of captured frames waiting to be written before frames are skipped
+static constexpr unsigned int maxPendingCaptures = 3;
+
+// Driver name which requests each driver be benchmarked at startup
+static constexpr const char * fastestDriver = "fastest";
+
+// Video driver used when running headless
+static constexpr const char * headlessVideoDriver = "dummy";
+
+// Size of the target, and the quads drawn onto it, when benchmarking a driver
+static constexpr int benchmarkTargetSize = 512;
+static constexpr int benchmarkQuadSize = 64;
+
+// Number of quads drawn when benchmarking a driver
+static constexpr size_t benchmarkQuads = 4000;
+
 namespace Aether {
+    // Split packed RGBA32 pixels into colours
+    static std::vector<Colour> toColours(const std::vector<uint8_t> & bytes) {
+        std::vector<Colour> colours;
+        colours.reserve(bytes.size() / 4);
+        for (size_t i = 0; i + 3 < bytes.size(); i += 4) {
+            colours.push_back(Colour(bytes[i], bytes[i + 1], bytes[i + 2], bytes[i + 3]));
+        }
+        return colours;
+    }
+
+    // Convert SDL's description of a driver into our own
+    static RendererInfo toRendererInfo(const SDL_RendererInfo & sdl) {
+        RendererInfo info;
+        info.name = (sdl.name != nullptr ? sdl.name : "");
+        info.accelerated = (sdl.flags & SDL_RENDERER_ACCELERATED);
+        info.vsync = (sdl.flags & SDL_RENDERER_PRESENTVSYNC);
+        info.renderTargets = (sdl.flags & SDL_RENDERER_TARGETTEXTURE);
+        info.geometry = false;
+        info.maxTextureWidth = std::max(sdl.max_texture_width, 0);
+        info.maxTextureHeight = std::max(sdl.max_texture_height, 0);
+        info.textureFormats.assign(sdl.texture_formats, sdl.texture_formats + sdl.num_texture_formats);
+        return info;
+    }
+
     Renderer::Renderer() {
         this->renderer = nullptr;
         this->window = nullptr;
+        this->framebuffer = nullptr;
+        this->headless_ = false;
         this->windowWidth_ = 0;
         this->windowHeight_ = 0;
+        this->outputWidth_ = 0;
+        this->outputHeight_ = 0;
+        this->renderScale_ = 1.0f;
 
         this->logHandler = nullptr;
         this->memoryUsage_ = 0;
         this->surfaceCount_ = 0;
         this->textureCount_ = 0;
 
+        this->geometrySupported = true;
+        this->currentFrame.wholeTarget = true;
+        this->clipStack.depth = 0;
+
+        this->frameTexture = nullptr;
+        this->damageTracking_ = false;
+        this->frameStarted = false;
+        this->originX = 0;
+        this->originY = 0;
+
+        this->presentMode_ = PresentMode::VSync;
+        this->frameLimit_ = defaultFrameLimit;
+        this->uploadBudget_ = defaultUploadBudget;
+        this->uploadedBytes = 0;
+        this->lowMemory_ = false;
+        this->lastFrame = 0;
+        this->lastPresent = 0;
+        this->frameStats_ = FrameStats{0, 0, 0, 0, 0, 0};
+        this->submittedCommands = 0;
+        this->submittedBatches = 0;
+
+        this->frameRequested_ = true;
+        this->wakeEvent = static_cast<uint32_t>(-1);
+
+        this->shapeCacheHits_ = 0;
+        this->shapeCacheMisses_ = 0;
+        this->shapeCacheMemory_ = 0;
+        this->poolLimit_ = defaultTexturePoolLimit;
+        this->poolMemory_ = 0;
+        this->poolHits_ = 0;
+        this->poolMisses_ = 0;
+        this->atlasPageSize_ = defaultAtlasPageSize;
+        this->releasedBytes = 0;
+        this->textureBudget_ = 0;
+        this->frameCount_ = 0;
+
         this->fontCache = nullptr;
         this->fontSpacing = 1.1;
+
+        this->info_.accelerated = false;
+        this->info_.vsync = false;
+        this->info_.renderTargets = false;
+        this->info_.geometry = false;
+        this->info_.maxTextureWidth = 0;
+        this->info_.maxTextureHeight = 0;
+
+        this->pipelined_ = false;
+        this->pendingFrame.wholeTarget = true;
+        this->pendingGeometry = true;
+        this->framePending = false;
+        this->pendingReady = false;
+        this->pipelineStop = false;
+
+        this->capturing_ = false;
+        this->captureFormat = CaptureFormat::PNG;
+        this->captureCount = 0;
+        this->droppedCaptures = 0;
+        this->pendingCaptures = 0;
     }
 
     void Renderer::logMessage(const std::string & msg, const bool imp) {
@@ -39,49 +171,226 @@ namespace Aether {
         this->logHandler(msg, imp);
     }
 
-    SDL_Texture * Renderer::convertSurfaceToTexture(SDL_Surface * surf) {
+    bool Renderer::ShapeKey::operator<(const ShapeKey & other) const {
+        return std::tie(this->width, this->height, this->rx, this->ry, this->thick) < std::tie(other.width, other.height, other.rx, other.ry, other.thick);
+    }
+
+    bool Renderer::PoolKey::operator<(const PoolKey & other) const {
+        return std::tie(this->width, this->height, this->format, this->access) < std::tie(other.width, other.height, other.format, other.access);
+    }
+
+    SDL_Texture * Renderer::takePooledTexture(const PoolKey & key) {
+        if (this->poolLimit_ == 0) {
+            return nullptr;
+        }
+
+        std::map<PoolKey, std::vector<std::list<PooledTexture>::iterator>>::iterator it = this->poolIndex.find(key);
+        if (it == this->poolIndex.end()) {
+            this->poolMisses_++;
+            return nullptr;
+        }
+
+        // Prefer the most recently released texture
+        std::list<PooledTexture>::iterator pooled = it->second.back();
+        SDL_Texture * tex = pooled->texture;
+        it->second.pop_back();
+        if (it->second.empty()) {
+            this->poolIndex.erase(it);
+        }
+        this->texturePool.erase(pooled);
+        this->poolMemory_ -= textureBytes(tex);
+        this->poolHits_++;
+
+        SDL_SetTextureColorMod(tex, 255, 255, 255);
+        SDL_SetTextureAlphaMod(tex, 255);
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        return tex;
+    }
+
+    bool Renderer::poolTexture(SDL_Texture * tex) {
+        // Don't keep anything that would immediately push everything else out
+        size_t bytes = textureBytes(tex);
+        if (this->poolLimit_ == 0 || bytes == 0 || bytes > this->poolLimit_/2) {
+            return false;
+        }
+
+        PoolKey key;
+        SDL_QueryTexture(tex, &key.format, &key.access, &key.width, &key.height);
+        this->texturePool.push_back(PooledTexture{key, tex});
+        this->poolIndex[key].push_back(std::prev(this->texturePool.end()));
+        this->poolMemory_ += bytes;
+
+        this->trimTexturePool(this->poolLimit_);
+        return true;
+    }
+
+    void Renderer::trimTexturePool(const size_t limit) {
+        while (this->poolMemory_ > limit && !this->texturePool.empty()) {
+            PooledTexture & oldest = this->texturePool.front();
+            std::map<PoolKey, std::vector<std::list<PooledTexture>::iterator>>::iterator it = this->poolIndex.find(oldest.key);
+            it->second.erase(it->second.begin());
+            if (it->second.empty()) {
+                this->poolIndex.erase(it);
+            }
+
+            size_t bytes = textureBytes(oldest.texture);
+            SDL_DestroyTexture(oldest.texture);
+            this->poolMemory_ -= bytes;
+            this->memoryUsage_ -= bytes;
+            this->textureCount_--;
+            this->texturePool.pop_front();
+        }
+    }
+
+    SDL_Texture * Renderer::convertSurfaceToTexture(SDL_Surface * surf, const TextureFormat format) {
         // Sanity checks
         if (this->renderer == nullptr || surf == nullptr) {
             this->logMessage(std::string("Couldn't convert surface to texture: ") + std::string(surf == nullptr ? "Null surface passed" : "Renderer isn't initialized"), true);
             return nullptr;
         }
 
-        // Actually convert
-        SDL_Texture * tex = SDL_CreateTextureFromSurface(this->renderer, surf);
+        // Check if the surface was found to be opaque
+        bool isOpaque = false;
+        Rect opaqueArea;
+        {
+            std::scoped_lock<std::mutex> mtx(this->opaqueMtx);
+            std::unordered_map<SDL_Surface *, Rect>::iterator it = this->opaqueSurfaces.find(surf);
+            if (it != this->opaqueSurfaces.end()) {
+                isOpaque = true;
+                opaqueArea = it->second;
+                this->opaqueSurfaces.erase(it);
+            }
+        }
+
+        // If the surface is a shape, use the cached texture if another thread got there first
+        bool isShape = false;
+        ShapeKey key;
+        SDL_Texture * cached = nullptr;
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            std::unordered_map<SDL_Surface *, ShapeKey>::iterator it = this->pendingShapes.find(surf);
+            if (it != this->pendingShapes.end()) {
+                isShape = true;
+                key = it->second;
+                this->pendingShapes.erase(it);
+
+                std::map<ShapeKey, CachedShape>::iterator shape = this->shapeCache.find(key);
+                if (shape != this->shapeCache.end()) {
+                    shape->second.refs++;
+                    cached = shape->second.texture;
+                }
+            }
+        }
+        if (cached != nullptr) {
+            this->destroySurface(surf, true);
+            return cached;
+        }
+
+        // Actually convert, repacking the pixels first if a more compact format is wanted
+        // (overwriting a released texture of the same size and format if there is one). The texture is always
+        // created in the chosen format, as the pool is keyed by the format SDL reports for it
+        bool fullyOpaque = (isOpaque && opaqueArea.x == 0 && opaqueArea.y == 0 && opaqueArea.w == surf->w && opaqueArea.h == surf->h);
+        uint32_t pixelFormat = this->chooseTextureFormat(format, fullyOpaque);
+        SDL_Texture * tex = this->takePooledTexture(PoolKey{pixelFormat, SDL_TEXTUREACCESS_STATIC, surf->w, surf->h});
+        bool reused = (tex != nullptr);
+        SDL_Surface * upload = (pixelFormat == surf->format->format ? surf : SDL_ConvertSurfaceFormat(surf, pixelFormat, 0));
+        if (upload != nullptr) {
+            if (!reused) {
+                tex = SDL_CreateTexture(this->renderer, pixelFormat, SDL_TEXTUREACCESS_STATIC, upload->w, upload->h);
+            }
+            if (tex != nullptr) {
+                SDL_LockSurface(upload);
+                bool updated = (SDL_UpdateTexture(tex, nullptr, upload->pixels, upload->pitch) == 0);
+                SDL_UnlockSurface(upload);
+                if (!updated) {
+                    if (reused) {
+                        this->poolTexture(tex);
+                    } else {
+                        SDL_DestroyTexture(tex);
+                    }
+                    tex = nullptr;
+                }
+            }
+            if (upload != surf) {
+                SDL_FreeSurface(upload);
+            }
+        } else if (reused) {
+            this->poolTexture(tex);
+            tex = nullptr;
+        }
         if (tex == nullptr) {
             this->logMessage(std::string("Couldn't convert surface to texture: ") + std::string(SDL_GetError()), true);
         }
 
-        // Update monitoring variables
-        if (tex != nullptr) {
+        // Update monitoring variables, swapping the surface's size for the texture's
+        // (pooled textures are still counted)
+        this->memoryUsage_ -= (surf->pitch * surf->h);
+        if (tex != nullptr && !reused) {
+            SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
             this->textureCount_++;
-        } else {
-            this->memoryUsage_ -= (surf->pitch * surf->h);
+            this->memoryUsage_ += textureBytes(tex);
         }
         this->surfaceCount_--;
 
         // Free passed surface regardless of outcome
         this->destroySurface(surf, false);
+
+        // Add shapes to the cache
+        if (tex != nullptr && isShape) {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            this->shapeCache[key] = CachedShape{tex, 1};
+            this->cachedTextures[tex] = key;
+            this->shapeCacheMemory_ += textureBytes(tex);
+
+            // Everything between the corners of a filled shape is solid
+            if (key.thick <= 0.0f) {
+                int rx = std::ceil(std::min(key.rx, key.width/2.0f));
+                int ry = std::ceil(std::min(key.ry, key.height/2.0f));
+                if (key.width > 2*rx && key.height > 2*ry) {
+                    isOpaque = true;
+                    opaqueArea = Rect{rx, ry, key.width - 2*rx, key.height - 2*ry};
+                }
+            }
+        }
+
+        if (tex != nullptr && isOpaque) {
+            this->opaqueAreas[tex] = opaqueArea;
+        }
         return tex;
     }
 
-    SDL_Texture * Renderer::createTexture(const unsigned int width, const unsigned int height) {
+    SDL_Texture * Renderer::createTexture(const unsigned int width, const unsigned int height, const bool streaming) {
         // Sanity checks
         if (this->renderer == nullptr || width == 0 || height == 0) {
             this->logMessage(std::string("Couldn't create texture: ") + std::string(this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid dimensions requested"), true);
             return nullptr;
         }
 
-        // Create the texture
-        SDL_Texture * tex = SDL_CreateTexture(this->renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, width, height);
+        // Reuse a released texture if possible, clearing render targets as they're expected to start empty
+        int access = (streaming ? SDL_TEXTUREACCESS_STREAMING : SDL_TEXTUREACCESS_TARGET);
+        SDL_Texture * tex = this->takePooledTexture(PoolKey{SDL_PIXELFORMAT_RGBA32, access, static_cast<int>(width), static_cast<int>(height)});
+        if (tex != nullptr) {
+            if (!streaming) {
+                SDL_Texture * target = SDL_GetRenderTarget(this->renderer);
+                SDL_SetRenderTarget(this->renderer, tex);
+                SDL_SetRenderDrawColor(this->renderer, 0, 0, 0, 0);
+                SDL_RenderClear(this->renderer);
+                SDL_SetRenderTarget(this->renderer, target);
+            }
+            return tex;
+        }
+
+        // Otherwise create the texture
+        tex = SDL_CreateTexture(this->renderer, SDL_PIXELFORMAT_RGBA32, access, width, height);
         if (tex == nullptr) {
             this->logMessage(std::string("Couldn't create texture: ") + std::string(SDL_GetError()), true);
         }
 
         // Increment monitoring variables
         if (tex != nullptr) {
+            SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
             this->textureCount_++;
-            this->memoryUsage_ += (width * height * 4);     // 4 bytes per pixel
+            this->memoryUsage_ += textureBytes(tex);
         }
 
         return tex;
@@ -94,15 +403,258 @@ namespace Aether {
             return;
         }
 
-        // Destroy the texture, getting it's info first
-        int w, h;
-        SDL_QueryTexture(tex, nullptr, nullptr, &w, &h);
+        // Shared shapes are only destroyed once nothing else uses them
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            std::unordered_map<SDL_Texture *, ShapeKey>::iterator it = this->cachedTextures.find(tex);
+            if (it != this->cachedTextures.end()) {
+                std::map<ShapeKey, CachedShape>::iterator shape = this->shapeCache.find(it->second);
+                shape->second.refs--;
+                if (shape->second.refs > 0) {
+                    return;
+                }
+
+                this->shapeCacheMemory_ -= textureBytes(tex);
+                this->shapeCache.erase(shape);
+                this->cachedTextures.erase(it);
+            }
+        }
+        this->opaqueAreas.erase(tex);
+
+        // Submit anything queued or pending first, as it may reference this texture
+        if (this->pendingFrameUses(tex)) {
+            this->finishPendingFrame();
+        }
+        if (this->drawQueueUses(tex)) {
+            this->flushDrawQueue();
+        }
+
+        // Keep the texture to be reused if possible (but never the window's copy)
+        if (stats && tex != this->frameTexture && this->poolTexture(tex)) {
+            return;
+        }
+
+        // Destroy the texture, getting it's size first
+        size_t mem = textureBytes(tex);
         SDL_DestroyTexture(tex);
 
         // Decrease monitoring variables
         if (stats) {
             this->textureCount_--;
-            this->memoryUsage_ -= (w * h * 4);      // 4 bytes per pixel
+            this->memoryUsage_ -= mem;
+        }
+    }
+
+    void Renderer::releaseTexture(SDL_Texture * tex) {
+        if (tex == nullptr) {
+            this->logMessage("Couldn't release texture: Null texture passed", false);
+            return;
+        }
+
+        this->releasedBytes += textureBytes(tex);
+        std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+        this->releasedTextures.push_back(ReleasedTexture{tex, false, 0, 0});
+    }
+
+    void Renderer::discardDrawable(Drawable * drawable) {
+        std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+        this->discardedDrawables.push_back(drawable);
+    }
+
+    void Renderer::deleteDiscardedDrawables() {
+        std::vector<Drawable *> discarded;
+        {
+            std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+            discarded.swap(this->discardedDrawables);
+        }
+
+        for (Drawable * drawable : discarded) {
+            delete drawable;
+        }
+    }
+
+    void Renderer::releaseAtlasImage(SDL_Texture * tex, const int x, const int y) {
+        std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+        this->releasedTextures.push_back(ReleasedTexture{tex, true, x, y});
+    }
+
+    void Renderer::destroyReleasedTextures(std::vector<ReleasedTexture> & textures) {
+        for (const ReleasedTexture & released : textures) {
+            if (released.atlas) {
+                this->removeFromAtlas(released.texture, released.x, released.y);
+            } else {
+                this->releasedBytes -= textureBytes(released.texture);
+                this->destroyTexture(released.texture, true);
+            }
+        }
+        textures.clear();
+    }
+
+    SDL_Texture * Renderer::addToAtlas(SDL_Surface * surf, int & x, int & y) {
+        if (this->renderer == nullptr || surf == nullptr || this->atlasPageSize_ == 0) {
+            return nullptr;
+        }
+
+        // Only pack images which leave room for plenty of others
+        int size = this->atlasPageSize_;
+        if (this->info_.maxTextureWidth > 0) {
+            size = std::min<int>(size, this->info_.maxTextureWidth);
+        }
+        if (this->info_.maxTextureHeight > 0) {
+            size = std::min<int>(size, this->info_.maxTextureHeight);
+        }
+        int maxSize = std::min(maxAtlasImageSize, size/4);
+        if (surf->w > maxSize || surf->h > maxSize) {
+            return nullptr;
+        }
+
+        // Find space on an existing page, otherwise start a new one
+        int w = surf->w + 2*atlasPadding;
+        int h = surf->h + 2*atlasPadding;
+        uint32_t format = this->chooseTextureFormat(TextureFormat::Auto, false);
+        Rect area;
+        AtlasPage * page = nullptr;
+        for (AtlasPage & candidate : this->atlasPages) {
+            if (candidate.format == format && candidate.size == size && allocateAtlasArea(candidate, w, h, area)) {
+                page = &candidate;
+                break;
+            }
+        }
+
+        if (page == nullptr) {
+            SDL_Texture * tex = this->takePooledTexture(PoolKey{format, SDL_TEXTUREACCESS_STATIC, size, size});
+            if (tex == nullptr) {
+                tex = SDL_CreateTexture(this->renderer, format, SDL_TEXTUREACCESS_STATIC, size, size);
+                if (tex == nullptr) {
+                    this->logMessage(std::string("Couldn't create atlas page: ") + std::string(SDL_GetError()), true);
+                    return nullptr;
+                }
+                SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+                this->textureCount_++;
+                this->memoryUsage_ += textureBytes(tex);
+            }
+
+            this->atlasPages.push_back(AtlasPage{tex, format, size, 0, std::vector<AtlasShelf>(), std::map<std::pair<int, int>, Rect>()});
+            page = &this->atlasPages.back();
+            allocateAtlasArea(*page, w, h, area);
+        }
+        x = area.x + atlasPadding;
+        y = area.y + atlasPadding;
+        page->entries[std::make_pair(x, y)] = area;
+
+        // Upload the image surrounded by it's (transparent) padding
+        bool ok = false;
+        SDL_Surface * padded = SDL_CreateRGBSurfaceWithFormat(0, w, h, SDL_BITSPERPIXEL(format), format);
+        if (padded != nullptr) {
+            SDL_Rect dst = {atlasPadding, atlasPadding, surf->w, surf->h};
+            SDL_Rect r = {area.x, area.y, w, h};
+            SDL_SetSurfaceBlendMode(surf, SDL_BLENDMODE_NONE);
+            ok = (SDL_BlitSurface(surf, nullptr, padded, &dst) == 0 && SDL_UpdateTexture(page->texture, &r, padded->pixels, padded->pitch) == 0);
+            SDL_FreeSurface(padded);
+        }
+
+        SDL_Texture * tex = page->texture;
+        if (!ok) {
+            this->logMessage(std::string("Couldn't add image to atlas: ") + std::string(SDL_GetError()), true);
+            this->removeFromAtlas(tex, x, y);
+            return nullptr;
+        }
+
+        this->destroySurface(surf, true);
+        return tex;
+    }
+
+    bool Renderer::allocateAtlasArea(AtlasPage & page, const int w, const int h, Rect & area) {
+        for (AtlasShelf & shelf : page.shelves) {
+            // Skip shelves which are too short, or too tall to be worth using (unless unused)
+            bool empty = (shelf.cursor == 0);
+            if (shelf.height < h || (!empty && shelf.height - h > h/2)) {
+                continue;
+            }
+
+            // Fill gaps left by removed images first
+            for (size_t i = 0; i < shelf.gaps.size(); i++) {
+                Rect & gap = shelf.gaps[i];
+                if (gap.w >= w) {
+                    area = Rect{gap.x, shelf.y, w, h};
+                    gap.x += w;
+                    gap.w -= w;
+                    if (gap.w == 0) {
+                        shelf.gaps.erase(shelf.gaps.begin() + i);
+                    }
+                    return true;
+                }
+            }
+
+            if (page.size - shelf.cursor >= w) {
+                area = Rect{shelf.cursor, shelf.y, w, h};
+                shelf.cursor += w;
+                return true;
+            }
+        }
+
+        // Start a new shelf below the others
+        if (page.size - page.nextY >= h && page.size >= w) {
+            page.shelves.push_back(AtlasShelf{page.nextY, h, w, std::vector<Rect>()});
+            area = Rect{0, page.nextY, w, h};
+            page.nextY += h;
+            return true;
+        }
+
+        return false;
+    }
+
+    void Renderer::removeFromAtlas(SDL_Texture * tex, const int x, const int y) {
+        std::vector<AtlasPage>::iterator page = std::find_if(this->atlasPages.begin(), this->atlasPages.end(), [tex](const AtlasPage & p) {
+            return p.texture == tex;
+        });
+        if (page == this->atlasPages.end()) {
+            return;
+        }
+
+        std::map<std::pair<int, int>, Rect>::iterator entry = page->entries.find(std::make_pair(x, y));
+        if (entry == page->entries.end()) {
+            return;
+        }
+        Rect area = entry->second;
+        page->entries.erase(entry);
+
+        // Return the space to it's shelf, merging it with neighbouring gaps
+        for (AtlasShelf & shelf : page->shelves) {
+            if (shelf.y != area.y) {
+                continue;
+            }
+
+            Rect gap = Rect{area.x, shelf.y, area.w, shelf.height};
+            for (size_t i = 0; i < shelf.gaps.size();) {
+                Rect & other = shelf.gaps[i];
+                if (other.x + other.w == gap.x || gap.x + gap.w == other.x) {
+                    gap.x = std::min(gap.x, other.x);
+                    gap.w += other.w;
+                    shelf.gaps.erase(shelf.gaps.begin() + i);
+                } else {
+                    i++;
+                }
+            }
+
+            if (gap.x + gap.w == shelf.cursor) {
+                shelf.cursor = gap.x;
+            } else {
+                shelf.gaps.push_back(gap);
+            }
+            break;
+        }
+
+        // Drop empty shelves from the bottom so their space can be used for any height
+        while (!page->shelves.empty() && page->shelves.back().cursor == 0) {
+            page->nextY = page->shelves.back().y;
+            page->shelves.pop_back();
+        }
+
+        // Destroy the page once nothing is left on it
+        if (page->entries.empty()) {
+            this->atlasPages.erase(page);
+            this->destroyTexture(tex, true);
         }
     }
 
@@ -113,6 +665,16 @@ namespace Aether {
             return;
         }
 
+        // Forget the shape the surface was for (if any)
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            this->pendingShapes.erase(surf);
+        }
+        {
+            std::scoped_lock<std::mutex> mtx(this->opaqueMtx);
+            this->opaqueSurfaces.erase(surf);
+        }
+
         // Destroy the surface
         int mem = surf->pitch * surf->h;
         SDL_FreeSurface(surf);
@@ -124,290 +686,1495 @@ namespace Aether {
         }
     }
 
-    void Renderer::drawFilledRect(const Colour & col, const int x, const int y, const int width, const int height) {
-        // Sanity check
-        if (this->renderer == nullptr) {
-            this->logMessage("Couldn't draw filled rectangle: Renderer isn't initialized", true);
-            return;
+    bool Renderer::drawQueueUses(SDL_Texture * tex) {
+        if (this->drawQueue.empty()) {
+            return false;
         }
 
-        // Form SDL_Rect and draw rectangle
-        SDL_Rect rect = {x, y, width, height};
-        SDL_SetRenderDrawColor(this->renderer, col.r(), col.g(), col.b(), col.a());
-        SDL_RenderFillRect(this->renderer, &rect);
+        if (!this->layers.empty() && this->layers.back().texture == tex) {
+            return true;
+        }
+        return std::any_of(this->drawQueue.begin(), this->drawQueue.end(), [tex](const DrawCommand & cmd) {
+            return (cmd.texture == tex);
+        });
     }
 
-    void Renderer::drawTexture(SDL_Texture * tex, const Colour & col, const int x, const int y, const unsigned int width, const unsigned int height, const int maskX, const int maskY, const unsigned int maskW, const unsigned int maskH) {
-        // Sanity check (no logging as this will be called often)
-        if (this->renderer == nullptr || tex == nullptr) {
+    void Renderer::flushDrawQueue() {
+        // Sanity check (not logged as this will be called often)
+        if (this->renderer == nullptr || this->drawQueue.empty()) {
+            this->drawQueue.clear();
             return;
         }
 
-        // Set texture's colour
-        SDL_SetTextureColorMod(tex, col.r(), col.g(), col.b());
-        SDL_SetTextureAlphaMod(tex, col.a());
-        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        // The pending frame must reach the window first if this draws onto the window too, or onto
+        // a layer it shows (drawing onto any other layer can go ahead of it)
+        if (this->layers.empty() || this->pendingFrameUses(this->layers.back().texture)) {
+            this->finishPendingFrame();
+        }
 
-        // Copy to framebuffer
-        SDL_Rect src = {maskX, maskY, maskW, maskH};
-        SDL_Rect dest = {x, y, width, height};
-        SDL_RenderCopy(this->renderer, tex, &src, &dest);
-    }
+        PreparedFrame & frame = this->currentFrame;
+        frame.queue.swap(this->drawQueue);
+        if (!this->layers.empty()) {
+            // Layers are always redrawn completely, so damage doesn't apply
+            frame.wholeTarget = true;
+            prepareFrame(frame, this->geometrySupported);
+            SDL_SetRenderTarget(this->renderer, this->layers.back().texture);
+            this->submitFrame(frame);
+            SDL_SetRenderTarget(this->renderer, nullptr);
 
-    void Renderer::renderOnTexture(SDL_Texture * tex, const std::function<void(SDL_Renderer *)> & func) {
-        // Sanity checks
-        std::string msg = "";
-        if (this->renderer == nullptr) {
-            msg = "Renderer isn't initialized";
-        } else if (tex == nullptr) {
-            msg = "Null texture passed";
-        } else if (func == nullptr) {
-            msg = "Null function passed";
+        } else {
+            this->freezeDamage(frame);
+            prepareFrame(frame, this->geometrySupported);
+            this->submitToWindow(frame);
         }
 
-        if (!msg.empty()) {
-            this->logMessage(std::string("Couldn't render on texture: ") + msg, true);
+        // Keep the allocated memory around for the next frame
+        frame.queue.swap(this->drawQueue);
+        this->drawQueue.clear();
+    }
+
+    void Renderer::freezeDamage(PreparedFrame & frame) {
+        frame.wholeTarget = !this->damageTracking_;
+        if (!this->damageTracking_) {
             return;
         }
 
-        // Change render target to texture and invoke function
-        SDL_SetRenderTarget(this->renderer, tex);
-        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
-        SDL_SetRenderDrawColor(this->renderer, 255, 255, 255, 0);
-        SDL_RenderClear(this->renderer);
-        func(this->renderer);
+        // The areas to redraw are fixed once anything in the frame is drawn, so any
+        // damage reported afterwards is left for the next frame
+        if (!this->frameStarted) {
+            this->frameDamage.swap(this->damage);
+            this->damage.clear();
+            this->frameStarted = true;
+        }
+        frame.areas = this->frameDamage;
+    }
 
-        // Reset back to window
-        SDL_SetRenderTarget(this->renderer, nullptr);
+    void Renderer::submitToWindow(PreparedFrame & frame) {
+        // Draw onto the offscreen copy of the window if there is one, mapping logical
+        // coordinates onto it's resolution (changing target resets the scale)
+        if (this->frameTexture != nullptr) {
+            SDL_SetRenderTarget(this->renderer, this->frameTexture);
+            SDL_RenderSetScale(this->renderer, this->renderScale_, this->renderScale_);
+        }
+
+        this->submitFrame(frame);
+
+        if (this->frameTexture != nullptr) {
+            SDL_SetRenderTarget(this->renderer, nullptr);
+        }
     }
 
-    SDL_Surface * Renderer::scaleSurface(SDL_Surface * surface, const size_t width, const size_t height) {
-        // Convert surface to 'ImageData'
-        uint8_t * pixelPtr = static_cast<uint8_t *>(surface->pixels);
-        std::vector<uint8_t> data;
-        data.assign(pixelPtr, pixelPtr + (surface->pitch * surface->h));
-        ImageData * image = new ImageData(data, surface->w, surface->h, surface->pitch/surface->w);
-        data.clear();
+    void Renderer::cullOccludedQuads(std::vector<DrawCommand> & queue, std::vector<Rect> & occluders) {
+        // Walk from front to back, hiding quads which are covered by an opaque quad drawn after them
+        occluders.clear();
+        for (size_t i = queue.size(); i > 0; i--) {
+            DrawCommand & cmd = queue[i - 1];
+
+            // Anything drawn before the target is cleared is overwritten
+            if (cmd.type == DrawCommandType::Clear) {
+                for (size_t j = 0; j < i - 1; j++) {
+                    if (queue[j].type == DrawCommandType::Quad) {
+                        queue[j].w = 0;
+                    }
+                }
+                break;
+            }
 
-        // Resize and replace surface
-        ImageData * scaled = Utils::Image::scaleOptimal(image, width, height);
-        if (scaled == nullptr) {
-            this->logMessage(std::string("Couldn't scale image to: ") + std::to_string(width) + std::string("x") + std::to_string(height), true);
+            if (cmd.type != DrawCommandType::Quad || cmd.w <= 0 || cmd.h <= 0) {
+                continue;
+            }
 
-        } else {
-            SDL_Surface * surf = SDL_CreateRGBSurfaceWithFormat(0, scaled->width(), scaled->height(), 32, SDL_PIXELFORMAT_RGBA32);
-            if (surf == nullptr) {
-                this->logMessage(std::string("Couldn't create scaled surface: ") + std::string(SDL_GetError()), true);
+            // Quads are already trimmed to their clip, and are hidden by being given no size
+            Rect area = {cmd.x, cmd.y, cmd.w, cmd.h};
 
-            } else {
-                this->destroySurface(surface, false);
-                surface = surf;
-                data = scaled->toByteVector();
-                std::memcpy(surface->pixels, &data[0], data.size());
+            bool hidden = std::any_of(occluders.begin(), occluders.end(), [&area](const Rect & r) {
+                return (area.x >= r.x && area.y >= r.y && area.x + area.w <= r.x + r.w && area.y + area.h <= r.y + r.h);
+            });
+            if (hidden) {
+                cmd.w = 0;
+                continue;
             }
-        }
 
-        delete image;
-        delete scaled;
+            // Remember the largest opaque areas. Filtering can blend in neighbouring texels at
+            // the edges of a stretched texture, so only trust the inside of those.
+            if (cmd.opaque) {
+                Rect solid = area;
+                if (cmd.texture != nullptr) {
+                    solid = Rect{area.x + 1, area.y + 1, area.w - 2, area.h - 2};
+                }
+                if (solid.w <= 0 || solid.h <= 0) {
+                    continue;
+                }
 
-        return surface;
+                if (occluders.size() < maxOccluders) {
+                    occluders.push_back(solid);
+                } else {
+                    std::vector<Rect>::iterator smallest = std::min_element(occluders.begin(), occluders.end(), [](const Rect & a, const Rect & b) {
+                        return (a.w * a.h < b.w * b.h);
+                    });
+                    if (smallest->w * smallest->h < solid.w * solid.h) {
+                        *smallest = solid;
+                    }
+                }
+            }
+        }
     }
 
-    void Renderer::setLogHandler(const LogHandler & func) {
-        this->logHandler = func;
+    uint32_t Renderer::chooseTextureFormat(const TextureFormat format, const bool opaque) {
+        // Work out the preferred formats, most compact first
+        std::vector<uint32_t> preferred;
+        bool dropAlpha = (format == TextureFormat::Opaque || (format == TextureFormat::Auto && opaque));
+        if (dropAlpha) {
+            if (this->lowMemory_) {
+                preferred.push_back(SDL_PIXELFORMAT_RGB565);
+            }
+            preferred.push_back(SDL_PIXELFORMAT_RGB24);
+
+        } else if (format == TextureFormat::Compact || (format == TextureFormat::Auto && this->lowMemory_)) {
+            preferred.push_back(SDL_PIXELFORMAT_RGBA4444);
+            preferred.push_back(SDL_PIXELFORMAT_ABGR4444);
+        }
+
+        // Only use formats the backend stores natively, otherwise SDL converts back to 32-bit anyway
+        for (uint32_t pixelFormat : preferred) {
+            if (this->supportsTextureFormat(pixelFormat)) {
+                return pixelFormat;
+            }
+        }
+        return SDL_PIXELFORMAT_RGBA32;
     }
 
-    bool Renderer::initialize(const std::string & name, const unsigned int windowW, const unsigned int windowH) {
+    size_t Renderer::textureBytes(SDL_Texture * tex) {
+        uint32_t format;
+        int w, h;
+        if (tex == nullptr || SDL_QueryTexture(tex, &format, nullptr, &w, &h) != 0) {
+            return 0;
+        }
+
+        return static_cast<size_t>(w) * h * SDL_BYTESPERPIXEL(format);
+    }
+
+    void Renderer::markIfOpaque(SDL_Surface * surf) {
+        if (surf == nullptr || surf->format->format != SDL_PIXELFORMAT_RGBA32) {
+            return;
+        }
+
+        // Stop as soon as a transparent pixel is found
+        for (int y = 0; y < surf->h; y++) {
+            uint8_t * row = static_cast<uint8_t *>(surf->pixels) + y*surf->pitch;
+            for (int x = 0; x < surf->w; x++) {
+                if (row[4*x + 3] != 255) {
+                    return;
+                }
+            }
+        }
+
+        std::scoped_lock<std::mutex> mtx(this->opaqueMtx);
+        this->opaqueSurfaces[surf] = Rect{0, 0, surf->w, surf->h};
+    }
+
+    void Renderer::prepareFrame(PreparedFrame & frame, const bool geometry) {
+        frame.batches.clear();
+        frame.vertices.clear();
+        frame.indices.clear();
+        cullOccludedQuads(frame.queue, frame.occluders);
+
+        // Walk the queue once per area being redrawn, grouping consecutive quads with the same texture into batches
+        size_t areas = (frame.wholeTarget ? 1 : frame.areas.size());
+        for (size_t area = 0; area < areas; area++) {
+            // Skip everything if the area is empty
+            if (!frame.wholeTarget && (frame.areas[area].w <= 0 || frame.areas[area].h <= 0)) {
+                continue;
+            }
+
+            size_t batchStart = 0;
+            for (size_t i = 0; i < frame.queue.size(); i++) {
+                const DrawCommand & cmd = frame.queue[i];
+                if (cmd.type == DrawCommandType::Quad) {
+                    // Culled quads can be skipped over without ending the batch
+                    if (cmd.w <= 0) {
+                        continue;
+                    }
+
+                    if (i != batchStart && cmd.texture != frame.queue[batchStart].texture) {
+                        addBatch(frame, batchStart, i, area, geometry);
+                        batchStart = i;
+                    }
+                    continue;
+                }
+
+                // Any other command ends the current batch
+                addBatch(frame, batchStart, i, area, geometry);
+                batchStart = i + 1;
+
+                if (cmd.type == DrawCommandType::Clear) {
+                    frame.batches.push_back(Batch{DrawCommandType::Clear, nullptr, cmd.colour, i, i + 1, area, 0, 0, 0, 0});
+                }
+            }
+            addBatch(frame, batchStart, frame.queue.size(), area, geometry);
+        }
+    }
+
+    bool Renderer::skipQuad(const DrawCommand & cmd, const Rect * clip) {
+        if (cmd.w <= 0 || cmd.h <= 0) {
+            return true;
+        }
+        return (clip != nullptr && !(cmd.x < clip->x + clip->w && cmd.x + cmd.w > clip->x && cmd.y < clip->y + clip->h && cmd.y + cmd.h > clip->y));
+    }
+
+    void Renderer::addBatch(PreparedFrame & frame, const size_t first, const size_t last, const size_t area, const bool geometry) {
+        if (first >= last) {
+            return;
+        }
+
+        // Without geometry the quads are copied straight from the queue when submitted
+        Batch batch = {DrawCommandType::Quad, frame.queue[first].texture, Colour(255, 255, 255, 255), first, last, area, frame.vertices.size(), 0, frame.indices.size(), 0};
+        if (!geometry) {
+            frame.batches.push_back(batch);
+            return;
+        }
+
+        // Form two triangles per quad, leaving out those which can't be seen
+        const Rect * clip = (frame.wholeTarget ? nullptr : &frame.areas[area]);
+        for (size_t i = first; i < last; i++) {
+            const DrawCommand & cmd = frame.queue[i];
+            if (skipQuad(cmd, clip)) {
+                continue;
+            }
+
+            SDL_Color col = {cmd.colour.r(), cmd.colour.g(), cmd.colour.b(), cmd.colour.a()};
+            float x1 = cmd.x;
+            float y1 = cmd.y;
+            float x2 = cmd.x + cmd.w;
+            float y2 = cmd.y + cmd.h;
+
+            int idx = frame.vertices.size() - batch.vertex;
+            frame.vertices.push_back(SDL_Vertex{{x1, y1}, col, {cmd.u1, cmd.v1}});
+            frame.vertices.push_back(SDL_Vertex{{x2, y1}, col, {cmd.u2, cmd.v1}});
+            frame.vertices.push_back(SDL_Vertex{{x2, y2}, col, {cmd.u2, cmd.v2}});
+            frame.vertices.push_back(SDL_Vertex{{x1, y2}, col, {cmd.u1, cmd.v2}});
+
+            frame.indices.push_back(idx);
+            frame.indices.push_back(idx + 1);
+            frame.indices.push_back(idx + 2);
+            frame.indices.push_back(idx);
+            frame.indices.push_back(idx + 2);
+            frame.indices.push_back(idx + 3);
+        }
+
+        batch.vertexCount = frame.vertices.size() - batch.vertex;
+        batch.indexCount = frame.indices.size() - batch.index;
+        if (batch.vertexCount > 0) {
+            frame.batches.push_back(batch);
+        }
+    }
+
+    void Renderer::submitFrame(PreparedFrame & frame) {
+        // Rasterizing shapes can leave the draw blend mode changed, so reset it once
+        SDL_SetRenderDrawBlendMode(this->renderer, SDL_BLENDMODE_BLEND);
+        SDL_RenderSetClipRect(this->renderer, nullptr);
+
+        this->submittedCommands += frame.queue.size();
+        this->submittedBatches += frame.batches.size();
+
+        size_t currentArea = static_cast<size_t>(-1);
+        for (const Batch & batch : frame.batches) {
+            // Quads are clipped as they're queued, so the backend only needs to limit drawing to the area being redrawn
+            const Rect * clip = (frame.wholeTarget ? nullptr : &frame.areas[batch.area]);
+            if (clip != nullptr && batch.area != currentArea) {
+                SDL_Rect r = {clip->x, clip->y, clip->w, clip->h};
+                SDL_RenderSetClipRect(this->renderer, &r);
+                currentArea = batch.area;
+            }
+
+            if (batch.type == DrawCommandType::Clear) {
+                // Clearing ignores the clip rectangle, so only fill the area being redrawn
+                SDL_SetRenderDrawColor(this->renderer, batch.colour.r(), batch.colour.g(), batch.colour.b(), batch.colour.a());
+                if (clip == nullptr) {
+                    SDL_RenderClear(this->renderer);
+                } else {
+                    SDL_Rect r = {clip->x, clip->y, clip->w, clip->h};
+                    SDL_SetRenderDrawBlendMode(this->renderer, SDL_BLENDMODE_NONE);
+                    SDL_RenderFillRect(this->renderer, &r);
+                    SDL_SetRenderDrawBlendMode(this->renderer, SDL_BLENDMODE_BLEND);
+                }
+                continue;
+            }
+
+            if (!this->geometrySupported || batch.vertexCount == 0) {
+                this->submitCopies(frame.queue, batch.first, batch.last, clip);
+                continue;
+            }
+
+            // Retry this batch the slow way if the backend can't draw geometry
+            if (SDL_RenderGeometry(this->renderer, batch.texture, &frame.vertices[batch.vertex], batch.vertexCount, &frame.indices[batch.index], batch.indexCount) < 0) {
+                this->logMessage(std::string("Couldn't render geometry, falling back to copying: ") + std::string(SDL_GetError()), true);
+                this->geometrySupported = false;
+                this->submitCopies(frame.queue, batch.first, batch.last, clip);
+            }
+        }
+    }
+
+    bool Renderer::clipQuad(DrawCommand & cmd) {
+        if (this->clipStack.depth == 0) {
+            return true;
+        }
+
+        // Find the part of the quad within the clip
+        const Rect & clip = this->clipStack.rects[std::min(this->clipStack.depth, maxClipDepth) - 1];
+        int x1 = std::max(cmd.x, clip.x);
+        int y1 = std::max(cmd.y, clip.y);
+        int x2 = std::min(cmd.x + cmd.w, clip.x + clip.w);
+        int y2 = std::min(cmd.y + cmd.h, clip.y + clip.h);
+        if (x2 <= x1 || y2 <= y1) {
+            return false;
+        }
+
+        // Move the texture coordinates in proportion to the trimmed edges
+        if (cmd.texture != nullptr) {
+            float du = (cmd.u2 - cmd.u1)/cmd.w;
+            float dv = (cmd.v2 - cmd.v1)/cmd.h;
+            float u1 = cmd.u1 + (x1 - cmd.x) * du;
+            float v1 = cmd.v1 + (y1 - cmd.y) * dv;
+            cmd.u2 = cmd.u1 + (x2 - cmd.x) * du;
+            cmd.v2 = cmd.v1 + (y2 - cmd.y) * dv;
+            cmd.u1 = u1;
+            cmd.v1 = v1;
+        }
+
+        cmd.x = x1;
+        cmd.y = y1;
+        cmd.w = x2 - x1;
+        cmd.h = y2 - y1;
+        return true;
+    }
+
+    void Renderer::submitCopies(const std::vector<DrawCommand> & queue, const size_t first, const size_t last, const Rect * clip) {
+        SDL_Texture * tex = queue[first].texture;
+        for (size_t i = first; i < last; i++) {
+            const DrawCommand & cmd = queue[i];
+            if (skipQuad(cmd, clip)) {
+                continue;
+            }
+
+            SDL_Rect dest = {cmd.x, cmd.y, cmd.w, cmd.h};
+            if (tex == nullptr) {
+                SDL_SetRenderDrawColor(this->renderer, cmd.colour.r(), cmd.colour.g(), cmd.colour.b(), cmd.colour.a());
+                SDL_RenderFillRect(this->renderer, &dest);
+                continue;
+            }
+
+            int w, h;
+            SDL_QueryTexture(tex, nullptr, nullptr, &w, &h);
+            // Regions narrower than a pixel (e.g. stretched nine-slice edges) still need one pixel
+            SDL_Rect src = {static_cast<int>(cmd.u1 * w), static_cast<int>(cmd.v1 * h), static_cast<int>((cmd.u2 - cmd.u1) * w + 0.5f), static_cast<int>((cmd.v2 - cmd.v1) * h + 0.5f)};
+            src.w = (src.w < 1 ? 1 : src.w);
+            src.h = (src.h < 1 ? 1 : src.h);
+            SDL_SetTextureColorMod(tex, cmd.colour.r(), cmd.colour.g(), cmd.colour.b());
+            SDL_SetTextureAlphaMod(tex, cmd.colour.a());
+            SDL_RenderCopy(this->renderer, tex, &src, &dest);
+        }
+    }
+
+    void Renderer::drawFilledRect(const Colour & col, const int x, const int y, const int width, const int height) {
+        // Sanity check
+        if (this->renderer == nullptr) {
+            this->logMessage("Couldn't draw filled rectangle: Renderer isn't initialized", true);
+            return;
+        }
+
+        // Don't bother queueing anything that won't be visible
+        if (col.a() == 0 || width <= 0 || height <= 0) {
+            return;
+        }
+
+        // Queue an untextured quad, trimmed to the clip
+        DrawCommand cmd = {DrawCommandType::Quad, nullptr, col, x - this->originX, y - this->originY, width, height, 0.0f, 0.0f, 0.0f, 0.0f, col.a() == 255};
+        if (this->clipQuad(cmd)) {
+            this->drawQueue.push_back(cmd);
+        }
+    }
+
+    void Renderer::drawTexture(SDL_Texture * tex, const Colour & col, const int x, const int y, const unsigned int width, const unsigned int height, const int maskX, const int maskY, const unsigned int maskW, const unsigned int maskH) {
+        this->drawTextureRegion(tex, col, x, y, width, height, maskX, maskY, maskW, maskH);
+    }
+
+    void Renderer::drawTextureRegion(SDL_Texture * tex, const Colour & col, const int x, const int y, const int width, const int height, const float srcX, const float srcY, const float srcW, const float srcH) {
+        // Sanity check (no logging as this will be called often)
+        if (this->renderer == nullptr || tex == nullptr) {
+            return;
+        }
+
+        // Don't bother queueing anything that won't be visible
+        if (col.a() == 0 || width <= 0 || height <= 0 || this->clipped(x, y, width, height)) {
+            return;
+        }
+
+        // Convert region to texture coordinates and queue
+        int w, h;
+        SDL_QueryTexture(tex, nullptr, nullptr, &w, &h);
+        float u1 = srcX/w;
+        float v1 = srcY/h;
+        float u2 = (srcX + srcW)/w;
+        float v2 = (srcY + srcH)/h;
+
+        // The quad hides what's beneath if it only samples solid pixels
+        bool opaque = false;
+        if (col.a() == 255) {
+            std::unordered_map<SDL_Texture *, Rect>::iterator it = this->opaqueAreas.find(tex);
+            if (it != this->opaqueAreas.end()) {
+                const Rect & r = it->second;
+                opaque = (srcX >= r.x && srcY >= r.y && srcX + srcW <= r.x + r.w && srcY + srcH <= r.y + r.h);
+            }
+        }
+
+        DrawCommand cmd = {DrawCommandType::Quad, tex, col, x - this->originX, y - this->originY, width, height, u1, v1, u2, v2, opaque};
+        if (this->clipQuad(cmd)) {
+            this->drawQueue.push_back(cmd);
+        }
+    }
+
+    void Renderer::renderOnTexture(SDL_Texture * tex, const std::function<void(SDL_Renderer *)> & func) {
+        // Sanity checks
+        std::string msg = "";
+        if (this->renderer == nullptr) {
+            msg = "Renderer isn't initialized";
+        } else if (tex == nullptr) {
+            msg = "Null texture passed";
+        } else if (func == nullptr) {
+            msg = "Null function passed";
+        }
+
+        if (!msg.empty()) {
+            this->logMessage(std::string("Couldn't render on texture: ") + msg, true);
+            return;
+        }
+
+        // Change render target to texture and invoke function
+        SDL_SetRenderTarget(this->renderer, tex);
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(this->renderer, 255, 255, 255, 0);
+        SDL_RenderClear(this->renderer);
+        func(this->renderer);
+
+        // Reset back to window
+        SDL_SetRenderTarget(this->renderer, nullptr);
+    }
+
+    SDL_Surface * Renderer::scaleSurface(SDL_Surface * surface, const size_t width, const size_t height) {
+        // Convert surface to 'ImageData'
+        uint8_t * pixelPtr = static_cast<uint8_t *>(surface->pixels);
+        std::vector<uint8_t> data;
+        data.assign(pixelPtr, pixelPtr + (surface->pitch * surface->h));
+        ImageData * image = new ImageData(data, surface->w, surface->h, surface->pitch/surface->w);
+        data.clear();
+
+        // Resize and replace surface
+        ImageData * scaled = Utils::Image::scaleOptimal(image, width, height);
+        if (scaled == nullptr) {
+            this->logMessage(std::string("Couldn't scale image to: ") + std::to_string(width) + std::string("x") + std::to_string(height), true);
+
+        } else {
+            SDL_Surface * surf = SDL_CreateRGBSurfaceWithFormat(0, scaled->width(), scaled->height(), 32, SDL_PIXELFORMAT_RGBA32);
+            if (surf == nullptr) {
+                this->logMessage(std::string("Couldn't create scaled surface: ") + std::string(SDL_GetError()), true);
+
+            } else {
+                this->destroySurface(surface, false);
+                surface = surf;
+                data = scaled->toByteVector();
+                std::memcpy(surface->pixels, &data[0], data.size());
+            }
+        }
+
+        delete image;
+        delete scaled;
+
+        return surface;
+    }
+
+    void Renderer::setLogHandler(const LogHandler & func) {
+        this->logHandler = func;
+    }
+
+    bool Renderer::initialize(const std::string & name, const unsigned int windowW, const unsigned int windowH, const PresentMode mode, const std::string & driver, const bool headless) {
         // Sanity check
         if (this->window != nullptr || this->renderer != nullptr || this->fontCache != nullptr) {
             this->logMessage("Already initialized!", true);
             return true;
         }
 
-        // Initialize libraries
-        if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_JOYSTICK) < 0) {
-            this->logMessage(std::string("Couldn't init SDL: ") + std::string(SDL_GetError()), true);
-            return false;
+        // Initialize libraries, without a display or controllers when headless
+        this->headless_ = headless;
+        if (headless) {
+            SDL_SetHint(SDL_HINT_VIDEODRIVER, headlessVideoDriver);
+        }
+        if (SDL_Init(headless ? SDL_INIT_VIDEO : SDL_INIT_VIDEO | SDL_INIT_JOYSTICK) < 0) {
+            this->logMessage(std::string("Couldn't init SDL: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+
+        int flags = IMG_INIT_JPG | IMG_INIT_PNG;
+        if ((IMG_Init(flags) & flags) != flags) {
+            this->logMessage("Couldn't initialize SDL_image", true);
+            return false;
+        }
+
+        // Create the window
+        if (headless) {
+            this->window = SDL_CreateWindow(name.empty() ? "Aether" : name.c_str(), 0, 0, windowW, windowH, SDL_WINDOW_HIDDEN);
+            this->windowWidth_ = windowW;
+            this->windowHeight_ = windowH;
+        } else {
+            #ifdef __SWITCH__
+            this->window = SDL_CreateWindow(name.empty() ? "Aether" : name.c_str(), 0, 0, 1280, 720, 0);
+            this->windowWidth_ = 1280;
+            this->windowHeight_ = 720;
+            #else
+            this->window = SDL_CreateWindow(name.empty() ? "Aether" : name.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, windowW, windowH, 0);
+            this->windowWidth_ = windowW;
+            this->windowHeight_ = windowH;
+            #endif
+        }
+
+        if (this->window == nullptr) {
+            this->logMessage(std::string("Couldn't create window: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+
+        // Everything is laid out in the requested size, which is stretched over the real window
+        int outW, outH;
+        SDL_GetWindowSize(this->window, &outW, &outH);
+        this->outputWidth_ = (outW > 0 ? outW : this->windowWidth_);
+        this->outputHeight_ = (outH > 0 ? outH : this->windowHeight_);
+
+        // Create the renderer, which draws into memory using the CPU when headless
+        SDL_RendererInfo sdlInfo;
+        if (headless) {
+            this->presentMode_ = PresentMode::Uncapped;
+            this->framebuffer = SDL_CreateRGBSurfaceWithFormat(0, this->outputWidth_, this->outputHeight_, 32, SDL_PIXELFORMAT_RGBA32);
+            if (this->framebuffer == nullptr) {
+                this->logMessage(std::string("Couldn't create framebuffer: ") + std::string(SDL_GetError()), true);
+                return false;
+            }
+            this->renderer = SDL_CreateSoftwareRenderer(this->framebuffer);
+
+        } else {
+            this->presentMode_ = mode;
+            int index = this->chooseDriver(driver);
+            bool accelerated = (SDL_GetRenderDriverInfo(index, &sdlInfo) != 0 || (sdlInfo.flags & SDL_RENDERER_ACCELERATED));
+            this->renderer = SDL_CreateRenderer(this->window, index, (accelerated ? SDL_RENDERER_ACCELERATED : 0) | (mode == PresentMode::VSync ? SDL_RENDERER_PRESENTVSYNC : 0));
+        }
+        if (this->renderer == nullptr) {
+            this->logMessage(std::string("Couldn't create renderer: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+
+        // Query what the backend is capable of
+        if (SDL_GetRendererInfo(this->renderer, &sdlInfo) == 0) {
+            this->info_ = toRendererInfo(sdlInfo);
+            this->logMessage("Using render driver: " + this->info_.name + " (max texture size " + std::to_string(this->info_.maxTextureWidth) + "x" + std::to_string(this->info_.maxTextureHeight) + ")", false);
+        } else {
+            this->logMessage(std::string("Couldn't query renderer info: ") + std::string(SDL_GetError()), true);
+        }
+
+        // Drivers can't be asked about geometry, so try drawing an empty triangle
+        SDL_Vertex probe[3] = {};
+        this->geometrySupported = (SDL_RenderGeometry(this->renderer, nullptr, probe, 3, nullptr, 0) == 0);
+        if (!this->geometrySupported) {
+            this->logMessage(std::string("Geometry isn't supported, quads will be copied one by one: ") + std::string(SDL_GetError()), false);
+        }
+
+        // Prepare controller support
+        #ifdef __SWITCH__
+        if (!headless && SDL_JoystickOpen(0) == nullptr) {
+            this->logMessage(std::string("Couldn't open joystick device: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+        #endif
+
+        // Reserve an event for waking up the main loop
+        this->wakeEvent = SDL_RegisterEvents(1);
+        if (this->wakeEvent == static_cast<uint32_t>(-1)) {
+            this->logMessage("Couldn't register wake event, idle waits will rely on timeouts", false);
+        }
+
+        // Set up blending
+        SDL_SetRenderDrawBlendMode(this->renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "2");
+
+        // Finally set up platform specific things
+        #ifdef __SWITCH__
+        Result rc = plInitialize(PlServiceType_User);
+        if (!R_SUCCEEDED(rc)) {
+            this->logMessage(std::string("Couldn't initialize pl: ") + std::to_string(rc), true);
+            return false;
+        }
+        #endif
+
+        // Frames need to be scaled if the window isn't the requested size
+        if (!this->updateFrameTexture()) {
+            this->logMessage("Couldn't create frame texture, frames won't be scaled", true);
+        }
+
+        this->fontCache = new FontCache(this);
+        this->logMessage("Initialized successfully!", false);
+        return true;
+    }
+
+    void Renderer::cleanup() {
+        // Show anything still pending and stop the pipeline thread
+        this->setPipelined(false);
+        this->stopCapture();
+        this->deleteDiscardedDrawables();
+        this->destroyReleasedTextures(this->pendingReleases);
+        {
+            std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+            this->destroyReleasedTextures(this->releasedTextures);
+        }
+
+        delete this->fontCache;
+        this->fontCache = nullptr;
+        #ifdef __SWITCH__
+        plExit();
+        #endif
+
+        this->clipStack.depth = 0;
+        this->layers.clear();
+        this->opaqueAreas.clear();
+        {
+            std::scoped_lock<std::mutex> mtx(this->opaqueMtx);
+            this->opaqueSurfaces.clear();
+        }
+        this->originX = 0;
+        this->originY = 0;
+        this->drawQueue.clear();
+
+        if (this->frameTexture != nullptr) {
+            this->destroyTexture(this->frameTexture, true);
+            this->frameTexture = nullptr;
+        }
+        for (AtlasPage & page : this->atlasPages) {
+            this->destroyTexture(page.texture, true);
+        }
+        this->atlasPages.clear();
+        this->trimTexturePool(0);
+        this->damage.clear();
+        this->frameDamage.clear();
+
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            this->shapeCache.clear();
+            this->cachedTextures.clear();
+            this->pendingShapes.clear();
+        }
+
+        if (this->renderer != nullptr) {
+            SDL_DestroyRenderer(this->renderer);
+            this->renderer = nullptr;
+        }
+
+        if (this->framebuffer != nullptr) {
+            SDL_FreeSurface(this->framebuffer);
+            this->framebuffer = nullptr;
+        }
+
+        if (this->window != nullptr) {
+            SDL_DestroyWindow(this->window);
+            this->window = nullptr;
+        }
+        this->headless_ = false;
+
+        IMG_Quit();
+        SDL_Quit();
+        this->logMessage("Cleaned up", false);
+    }
+
+    bool Renderer::headless() {
+        return this->headless_;
+    }
+
+    unsigned int Renderer::memoryUsage() {
+        return this->memoryUsage_;
+    }
+
+    unsigned int Renderer::surfaceCount() {
+        return this->surfaceCount_;
+    }
+
+    unsigned int Renderer::textureCount() {
+        return this->textureCount_;
+    }
+
+    FrameStats Renderer::frameStats() {
+        return this->frameStats_;
+    }
+
+    unsigned int Renderer::shapeCacheHits() {
+        return this->shapeCacheHits_;
+    }
+
+    unsigned int Renderer::shapeCacheMisses() {
+        return this->shapeCacheMisses_;
+    }
+
+    unsigned long Renderer::shapeCacheMemory() {
+        return this->shapeCacheMemory_;
+    }
+
+    unsigned int Renderer::texturePoolHits() {
+        return this->poolHits_;
+    }
+
+    unsigned int Renderer::texturePoolMisses() {
+        return this->poolMisses_;
+    }
+
+    size_t Renderer::texturePoolMemory() {
+        return this->poolMemory_;
+    }
+
+    unsigned int Renderer::windowWidth() {
+        return this->windowWidth_;
+    }
+
+    unsigned int Renderer::windowHeight() {
+        return this->windowHeight_;
+    }
+
+    void Renderer::fillWindow(const Colour & col) {
+        // Sanity check (not logged as this will be called often)
+        if (this->renderer == nullptr) {
+            return;
+        }
+
+        if (col.a() == 255) {
+            this->drawQueue.push_back(DrawCommand{DrawCommandType::Clear, nullptr, col, 0, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, false});
+        } else {
+            this->drawFilledRect(col, 0, 0, this->windowWidth_, this->windowHeight_);
+        }
+    }
+
+    void Renderer::present() {
+        // Sleep if not initialized to prevent spinlock
+        if (this->renderer == nullptr) {
+            this->logMessage("Fatal error: SDL not initialized", true);
+            SDL_Delay(500);
+            return;
+        }
+        this->frameCount_++;
+
+        // Show the previous frame before starting on this one, after which anything released
+        // while it was drawn can be destroyed
+        this->finishPendingFrame();
+        this->deleteDiscardedDrawables();
+        this->destroyReleasedTextures(this->pendingReleases);
+
+        // Hand the frame over to be prepared while the next one is updated, keeping what's
+        // been released until it's shown as it may still be drawn
+        if (this->pipelined_ && this->layers.empty()) {
+            {
+                std::scoped_lock<std::mutex> mtx(this->pipelineMtx);
+                this->pendingFrame.queue.swap(this->drawQueue);
+                this->drawQueue.clear();
+                this->freezeDamage(this->pendingFrame);
+                this->pendingGeometry = this->geometrySupported;
+                this->pendingReady = false;
+                this->framePending = true;
+            }
+            this->pipelineCond.notify_all();
+            {
+                std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+                this->pendingReleases.swap(this->releasedTextures);
+            }
+
+            this->frameDamage.clear();
+            this->frameStarted = false;
+            return;
+        }
+
+        this->flushDrawQueue();
+        this->presentFrame();
+
+        // Nothing references released textures once the frame is shown
+        std::vector<ReleasedTexture> released;
+        {
+            std::scoped_lock<std::mutex> mtx(this->releaseMtx);
+            released.swap(this->releasedTextures);
+        }
+        this->destroyReleasedTextures(released);
+    }
+
+    void Renderer::presentFrame() {
+        if (this->capturing_ || !this->screenshotPath.empty()) {
+            this->captureFrame();
+        }
+
+        // Stretch the offscreen copy of the window over the whole window if frames were drawn onto it
+        if (this->frameTexture != nullptr) {
+            SDL_RenderSetClipRect(this->renderer, nullptr);
+            SDL_RenderCopy(this->renderer, this->frameTexture, nullptr, nullptr);
+            this->frameDamage.clear();
+            this->frameStarted = false;
+        }
+
+        SDL_RenderPresent(this->renderer);
+
+        // Record what went into the frame
+        uint64_t now = SDL_GetPerformanceCounter();
+        this->frameStats_.frameTime = (this->lastPresent == 0 ? 0 : (now - this->lastPresent) * 1000.0/SDL_GetPerformanceFrequency());
+        this->frameStats_.drawCommands = this->submittedCommands;
+        this->frameStats_.batches = this->submittedBatches;
+        this->frameStats_.uploadedBytes = this->uploadedBytes;
+        this->frameStats_.textureCount = this->textureCount_;
+        this->frameStats_.memoryUsage = this->memoryUsage_;
+        this->lastPresent = now;
+        this->submittedCommands = 0;
+        this->submittedBatches = 0;
+
+        this->uploadedBytes = 0;
+        if (this->presentMode_ == PresentMode::Limited) {
+            this->limitFrameRate();
+        }
+    }
+
+    void Renderer::finishPendingFrame() {
+        if (!this->framePending) {
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> mtx(this->pipelineMtx);
+            this->pipelineCond.wait(mtx, [this]() {
+                return this->pendingReady;
+            });
+            this->framePending = false;
+        }
+
+        this->submitToWindow(this->pendingFrame);
+        this->presentFrame();
+    }
+
+    bool Renderer::pendingFrameUses(SDL_Texture * tex) {
+        if (!this->framePending) {
+            return false;
+        }
+
+        return std::any_of(this->pendingFrame.queue.begin(), this->pendingFrame.queue.end(), [tex](const DrawCommand & cmd) {
+            return (cmd.texture == tex);
+        });
+    }
+
+    void Renderer::pipelineLoop() {
+        std::unique_lock<std::mutex> mtx(this->pipelineMtx);
+        while (true) {
+            this->pipelineCond.wait(mtx, [this]() {
+                return (this->pipelineStop || (this->framePending && !this->pendingReady));
+            });
+            if (this->pipelineStop) {
+                return;
+            }
+
+            // The main thread doesn't touch the pending frame until it's marked as ready
+            mtx.unlock();
+            prepareFrame(this->pendingFrame, this->pendingGeometry);
+            mtx.lock();
+            this->pendingReady = true;
+            this->pipelineCond.notify_all();
+        }
+    }
+
+    void Renderer::setPipelined(const bool enable) {
+        if (enable == this->pipelined_) {
+            return;
+        }
+
+        if (enable) {
+            this->pipelineStop = false;
+            this->pipelineThread = std::thread(&Renderer::pipelineLoop, this);
+
+        } else {
+            this->finishPendingFrame();
+            {
+                std::scoped_lock<std::mutex> mtx(this->pipelineMtx);
+                this->pipelineStop = true;
+            }
+            this->pipelineCond.notify_all();
+            this->pipelineThread.join();
+        }
+        this->pipelined_ = enable;
+    }
+
+    bool Renderer::pipelined() {
+        return this->pipelined_;
+    }
+
+    void Renderer::limitFrameRate() {
+        uint64_t freq = SDL_GetPerformanceFrequency();
+        uint64_t target = this->lastFrame + freq/this->frameLimit_;
+        uint64_t now = SDL_GetPerformanceCounter();
+
+        // Start counting again from now if this is the first frame or we've fallen behind
+        if (this->lastFrame == 0 || now >= target) {
+            this->lastFrame = now;
+            return;
+        }
+
+        // Sleep for as long as we can be sure of, and then spin until the frame is due
+        while (now < target) {
+            uint64_t remaining = ((target - now) * 1000)/freq;
+            if (remaining > limiterSpinTime) {
+                SDL_Delay(remaining - limiterSpinTime);
+            }
+            now = SDL_GetPerformanceCounter();
+        }
+
+        // Measure from when the frame was due so the rate doesn't drift
+        this->lastFrame = target;
+    }
+
+    std::vector<RendererInfo> Renderer::availableDrivers() {
+        std::vector<RendererInfo> drivers;
+        int count = SDL_GetNumRenderDrivers();
+        for (int i = 0; i < count; i++) {
+            SDL_RendererInfo info;
+            if (SDL_GetRenderDriverInfo(i, &info) == 0) {
+                drivers.push_back(toRendererInfo(info));
+            }
+        }
+        return drivers;
+    }
+
+    RendererInfo Renderer::info() {
+        RendererInfo info = this->info_;
+        info.geometry = (this->renderer != nullptr && this->geometrySupported);
+        return info;
+    }
+
+    unsigned int Renderer::maxTextureWidth() {
+        return this->info_.maxTextureWidth;
+    }
+
+    unsigned int Renderer::maxTextureHeight() {
+        return this->info_.maxTextureHeight;
+    }
+
+    bool Renderer::supportsTextureFormat(const uint32_t format) {
+        return (std::find(this->info_.textureFormats.begin(), this->info_.textureFormats.end(), format) != this->info_.textureFormats.end());
+    }
+
+    int Renderer::chooseDriver(const std::string & driver) {
+        // Let SDL pick the first driver if nothing was requested
+        if (driver.empty()) {
+            return 0;
+        }
+
+        // Otherwise look for the driver by name
+        int count = SDL_GetNumRenderDrivers();
+        if (driver != fastestDriver) {
+            for (int i = 0; i < count; i++) {
+                SDL_RendererInfo info;
+                if (SDL_GetRenderDriverInfo(i, &info) == 0 && info.name != nullptr && driver == info.name) {
+                    return i;
+                }
+            }
+
+            this->logMessage("Couldn't find render driver '" + driver + "', using default", true);
+            return 0;
+        }
+
+        // Or time each driver that supports everything we need, keeping the quickest
+        int best = 0;
+        double bestTime = -1.0;
+        for (int i = 0; i < count; i++) {
+            SDL_RendererInfo info;
+            if (SDL_GetRenderDriverInfo(i, &info) != 0 || !(info.flags & SDL_RENDERER_TARGETTEXTURE)) {
+                continue;
+            }
+
+            double time = this->benchmarkDriver(i);
+            if (time < 0.0) {
+                this->logMessage(std::string("Couldn't benchmark render driver ") + info.name, false);
+                continue;
+            }
+
+            this->logMessage(std::string("Benchmarked render driver ") + info.name + ": " + std::to_string(time * 1000.0) + "ms", false);
+            if (bestTime < 0.0 || time < bestTime) {
+                best = i;
+                bestTime = time;
+            }
+        }
+        return best;
+    }
+
+    double Renderer::benchmarkDriver(const int index) {
+        SDL_Renderer * renderer = SDL_CreateRenderer(this->window, index, SDL_RENDERER_TARGETTEXTURE);
+        if (renderer == nullptr) {
+            return -1.0;
+        }
+
+        double time = -1.0;
+        SDL_Texture * target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, benchmarkTargetSize, benchmarkTargetSize);
+        SDL_Texture * quad = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, benchmarkQuadSize, benchmarkQuadSize);
+        if (target != nullptr && quad != nullptr) {
+            // Fill the quad with translucent white so it's blended like most of the UI
+            SDL_SetRenderTarget(renderer, quad);
+            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 128);
+            SDL_RenderClear(renderer);
+            SDL_SetTextureBlendMode(quad, SDL_BLENDMODE_BLEND);
+
+            // Reading a pixel back waits for all queued work, so do it once before starting
+            // the clock and once after drawing
+            SDL_SetRenderTarget(renderer, target);
+            SDL_Rect pixelRect = {0, 0, 1, 1};
+            uint32_t pixel;
+            SDL_RenderReadPixels(renderer, &pixelRect, SDL_PIXELFORMAT_RGBA8888, &pixel, sizeof(pixel));
+
+            uint64_t start = SDL_GetPerformanceCounter();
+            int range = benchmarkTargetSize - benchmarkQuadSize;
+            for (size_t i = 0; i < benchmarkQuads; i++) {
+                SDL_Rect rect = {static_cast<int>((i * 37) % range), static_cast<int>((i * 53) % range), benchmarkQuadSize, benchmarkQuadSize};
+                SDL_RenderCopy(renderer, quad, nullptr, &rect);
+            }
+            if (SDL_RenderReadPixels(renderer, &pixelRect, SDL_PIXELFORMAT_RGBA8888, &pixel, sizeof(pixel)) == 0) {
+                time = (SDL_GetPerformanceCounter() - start)/static_cast<double>(SDL_GetPerformanceFrequency());
+            }
+        }
+
+        if (quad != nullptr) {
+            SDL_DestroyTexture(quad);
+        }
+        if (target != nullptr) {
+            SDL_DestroyTexture(target);
+        }
+        SDL_DestroyRenderer(renderer);
+        return time;
+    }
+
+    bool Renderer::setPresentMode(const PresentMode mode) {
+        this->presentMode_ = mode;
+        this->lastFrame = 0;
+        if (this->renderer == nullptr) {
+            return true;
+        }
+
+        if (SDL_RenderSetVSync(this->renderer, mode == PresentMode::VSync ? 1 : 0) != 0) {
+            this->logMessage(std::string("Couldn't change vsync: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+        return true;
+    }
+
+    PresentMode Renderer::presentMode() {
+        return this->presentMode_;
+    }
+
+    void Renderer::setFrameLimit(const unsigned int fps) {
+        if (fps == 0) {
+            this->logMessage("Couldn't set frame limit: Frame rate must be non-zero", true);
+            return;
+        }
+
+        this->frameLimit_ = fps;
+        this->lastFrame = 0;
+    }
+
+    unsigned int Renderer::frameLimit() {
+        return this->frameLimit_;
+    }
+
+    void Renderer::setUploadBudget(const size_t bytes) {
+        this->uploadBudget_ = bytes;
+    }
+
+    size_t Renderer::uploadBudget() {
+        return this->uploadBudget_;
+    }
+
+    void Renderer::setTexturePoolLimit(const size_t bytes) {
+        this->poolLimit_ = bytes;
+        this->trimTexturePool(bytes);
+    }
+
+    size_t Renderer::texturePoolLimit() {
+        return this->poolLimit_;
+    }
+
+    void Renderer::setTextureBudget(const size_t bytes) {
+        this->textureBudget_ = bytes;
+    }
+
+    size_t Renderer::textureBudget() {
+        return this->textureBudget_;
+    }
+
+    size_t Renderer::textureBudgetExcess() {
+        // Textures waiting to be destroyed are already taken care of
+        size_t used = this->memoryUsage_;
+        size_t released = this->releasedBytes;
+        used = (used > released ? used - released : 0);
+        if (this->textureBudget_ == 0 || used <= this->textureBudget_) {
+            return 0;
+        }
+
+        // Free idle textures before anything in use
+        size_t excess = used - this->textureBudget_;
+        size_t pooled = this->poolMemory_;
+        this->trimTexturePool(pooled > excess ? pooled - excess : 0);
+        excess -= std::min(excess, pooled - this->poolMemory_);
+        return excess;
+    }
+
+    unsigned int Renderer::frameCount() {
+        return this->frameCount_;
+    }
+
+    void Renderer::setAtlasPageSize(const unsigned int size) {
+        this->atlasPageSize_ = size;
+    }
+
+    unsigned int Renderer::atlasPageSize() {
+        return this->atlasPageSize_;
+    }
+
+    unsigned int Renderer::atlasPageCount() {
+        return this->atlasPages.size();
+    }
+
+    void Renderer::setLowMemoryTextures(const bool enable) {
+        this->lowMemory_ = enable;
+    }
+
+    bool Renderer::lowMemoryTextures() {
+        return this->lowMemory_;
+    }
+
+    bool Renderer::reserveUpload(const size_t bytes) {
+        if (this->uploadBudget_ != 0 && this->uploadedBytes != 0 && this->uploadedBytes + bytes > this->uploadBudget_) {
+            return false;
+        }
+
+        this->uploadedBytes += bytes;
+        return true;
+    }
+
+    bool Renderer::setDamageTracking(const bool enable) {
+        // Sanity check
+        if (this->renderer == nullptr) {
+            this->logMessage("Couldn't change damage tracking: Renderer isn't initialized", true);
+            return false;
+        }
+
+        // Nothing to do if already in the requested state
+        if (enable == this->damageTracking_) {
+            return true;
+        }
+
+        // The window's contents are kept in a texture which is drawn over as elements change
+        this->damageTracking_ = enable;
+        this->damage.clear();
+        if (!this->updateFrameTexture()) {
+            this->logMessage("Couldn't enable damage tracking: Unable to create frame texture", true);
+            this->damageTracking_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    bool Renderer::updateFrameTexture() {
+        // Make sure nothing queued or pending is drawn to the wrong target
+        this->flushDrawQueue();
+        this->finishPendingFrame();
+        this->frameDamage.clear();
+        this->frameStarted = false;
+
+        // Work out what size (if any) the offscreen copy needs to be
+        bool needed = (this->damageTracking_ || this->renderScale_ != 1.0f || this->windowWidth_ != this->outputWidth_ || this->windowHeight_ != this->outputHeight_);
+        int width = std::max(1L, std::lround(this->windowWidth_ * this->renderScale_));
+        int height = std::max(1L, std::lround(this->windowHeight_ * this->renderScale_));
+        if (this->frameTexture != nullptr) {
+            int w, h;
+            SDL_QueryTexture(this->frameTexture, nullptr, nullptr, &w, &h);
+            if (needed && w == width && h == height) {
+                return true;
+            }
+
+            this->destroyTexture(this->frameTexture, true);
+            this->frameTexture = nullptr;
+        }
+
+        if (!needed) {
+            return true;
+        }
+
+        this->frameTexture = this->createTexture(width, height);
+        if (this->frameTexture == nullptr) {
+            return false;
+        }
+        SDL_SetTextureBlendMode(this->frameTexture, SDL_BLENDMODE_NONE);
+        this->damageAll();
+        return true;
+    }
+
+    unsigned int Renderer::outputWidth() {
+        return this->outputWidth_;
+    }
+
+    unsigned int Renderer::outputHeight() {
+        return this->outputHeight_;
+    }
+
+    bool Renderer::setLogicalSize(const unsigned int width, const unsigned int height) {
+        if (width == 0 || height == 0) {
+            this->logMessage("Couldn't set logical size: Invalid dimensions requested", true);
+            return false;
+        }
+
+        this->windowWidth_ = width;
+        this->windowHeight_ = height;
+        if (this->renderer == nullptr) {
+            return true;
+        }
+        return this->updateFrameTexture();
+    }
+
+    bool Renderer::setRenderScale(const float scale) {
+        if (scale <= 0.0f) {
+            this->logMessage("Couldn't set render scale: Scale must be positive", true);
+            return false;
+        }
+
+        this->renderScale_ = scale;
+        if (this->renderer == nullptr) {
+            return true;
+        }
+        return this->updateFrameTexture();
+    }
+
+    float Renderer::renderScale() {
+        return this->renderScale_;
+    }
+
+    bool Renderer::damageTracking() {
+        return this->damageTracking_;
+    }
+
+    void Renderer::addDamage(const int x, const int y, const int w, const int h) {
+        this->requestFrame();
+        if (!this->damageTracking_) {
+            return;
+        }
+
+        // Limit to the window
+        int x1 = std::max(x, 0);
+        int y1 = std::max(y, 0);
+        int x2 = std::min(x + w, static_cast<int>(this->windowWidth_));
+        int y2 = std::min(y + h, static_cast<int>(this->windowHeight_));
+        if (x2 <= x1 || y2 <= y1) {
+            return;
         }
 
-        int flags = IMG_INIT_JPG | IMG_INIT_PNG;
-        if ((IMG_Init(flags) & flags) != flags) {
-            this->logMessage("Couldn't initialize SDL_image", true);
-            return false;
+        // Absorb any areas this touches, repeating as the combined area may now reach others
+        size_t i = 0;
+        while (i < this->damage.size()) {
+            const Rect & r = this->damage[i];
+            if (x1 <= r.x + r.w && x2 >= r.x && y1 <= r.y + r.h && y2 >= r.y) {
+                x1 = std::min(x1, r.x);
+                y1 = std::min(y1, r.y);
+                x2 = std::max(x2, r.x + r.w);
+                y2 = std::max(y2, r.y + r.h);
+                this->damage.erase(this->damage.begin() + i);
+                i = 0;
+                continue;
+            }
+            i++;
         }
+        this->damage.push_back(Rect{x1, y1, x2 - x1, y2 - y1});
 
-        // Create the window
-        #ifdef __SWITCH__
-        this->window = SDL_CreateWindow(name.empty() ? "Aether" : name.c_str(), 0, 0, 1280, 720, 0);
-        this->windowWidth_ = 1280;
-        this->windowHeight_ = 720;
-        #else
-        this->window = SDL_CreateWindow(name.empty() ? "Aether" : name.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, windowW, windowH, 0);
-        this->windowWidth_ = windowW;
-        this->windowHeight_ = windowH;
-        #endif
+        // Each area replays the whole queue, so too many becomes slower than one larger area
+        if (this->damage.size() > maxDamageRects) {
+            for (const Rect & r : this->damage) {
+                x1 = std::min(x1, r.x);
+                y1 = std::min(y1, r.y);
+                x2 = std::max(x2, r.x + r.w);
+                y2 = std::max(y2, r.y + r.h);
+            }
+            this->damage.clear();
+            this->damage.push_back(Rect{x1, y1, x2 - x1, y2 - y1});
+        }
+    }
 
-        if (this->window == nullptr) {
-            this->logMessage(std::string("Couldn't create window: ") + std::string(SDL_GetError()), true);
-            return false;
+    void Renderer::damageAll() {
+        this->requestFrame();
+        if (!this->damageTracking_) {
+            return;
         }
 
-        // Create the renderer
-        this->renderer = SDL_CreateRenderer(this->window, 0, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-        if (this->renderer == nullptr) {
-            this->logMessage(std::string("Couldn't create renderer: ") + std::string(SDL_GetError()), true);
-            return false;
+        this->damage.clear();
+        this->damage.push_back(Rect{0, 0, static_cast<int>(this->windowWidth_), static_cast<int>(this->windowHeight_)});
+    }
+
+    Drawable * Renderer::createLayer(const unsigned int width, const unsigned int height) {
+        SDL_Texture * tex = this->createTexture(width, height);
+        if (tex == nullptr) {
+            return new Drawable();
         }
 
-        // Prepare controller support
-        #ifdef __SWITCH__
-        if (SDL_JoystickOpen(0) == nullptr) {
-            this->logMessage(std::string("Couldn't open joystick device: ") + std::string(SDL_GetError()), true);
-            return false;
+        // Drawing onto a transparent texture leaves it's colours multiplied by alpha,
+        // so they mustn't be multiplied again when the layer is drawn
+        SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+        if (SDL_SetTextureBlendMode(tex, premultiplied) != 0) {
+            this->logMessage("Premultiplied blending isn't supported, layers may have darker edges", false);
         }
-        #endif
 
-        // Set up blending
-        SDL_SetRenderDrawBlendMode(this->renderer, SDL_BLENDMODE_BLEND);
-        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "2");
+        return new Drawable(this, tex, width, height);
+    }
 
-        // Finally set up platform specific things
-        #ifdef __SWITCH__
-        Result rc = plInitialize(PlServiceType_User);
-        if (!R_SUCCEEDED(rc)) {
-            this->logMessage(std::string("Couldn't initialize pl: ") + std::to_string(rc), true);
+    bool Renderer::beginLayer(Drawable * layer, const int x, const int y) {
+        // Sanity checks
+        if (this->renderer == nullptr || layer == nullptr || layer->type() != Drawable::Type::Texture) {
+            this->logMessage(std::string("Couldn't begin layer: ") + std::string(this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid layer passed"), true);
             return false;
         }
-        #endif
 
-        this->fontCache = new FontCache(this);
-        this->logMessage("Initialized successfully!", false);
+        // Submit everything drawn so far onto the outer target
+        this->flushDrawQueue();
+
+        // Start with no clipping, remembering the outer target's clip
+        this->layers.push_back(Layer{layer->data.texture, x, y, this->clipStack});
+        this->clipStack.depth = 0;
+        this->originX = x;
+        this->originY = y;
+
+        // Clear to transparent black so the contents end up premultiplied
+        this->drawQueue.push_back(DrawCommand{DrawCommandType::Clear, nullptr, Colour(0, 0, 0, 0), 0, 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f, false});
         return true;
     }
 
-    void Renderer::cleanup() {
-        delete this->fontCache;
-        this->fontCache = nullptr;
-        #ifdef __SWITCH__
-        plExit();
-        #endif
-
-        while (!this->clipStack.empty()) {
-            delete this->clipStack.top();
-            this->clipStack.pop();
+    void Renderer::endLayer() {
+        if (this->layers.empty()) {
+            this->logMessage("Couldn't end layer: No layer has begun", true);
+            return;
         }
 
-        if (this->renderer != nullptr) {
-            SDL_DestroyRenderer(this->renderer);
-            this->renderer = nullptr;
-        }
+        // Submit the layer's contents
+        this->flushDrawQueue();
 
-        if (this->window != nullptr) {
-            SDL_DestroyWindow(this->window);
-            this->window = nullptr;
-        }
+        // Discard any clipping left behind and restore the outer target's clip
+        this->clipStack = this->layers.back().clipStack;
+        this->layers.pop_back();
 
-        IMG_Quit();
-        SDL_Quit();
-        this->logMessage("Cleaned up", false);
+        this->originX = (this->layers.empty() ? 0 : this->layers.back().x);
+        this->originY = (this->layers.empty() ? 0 : this->layers.back().y);
     }
 
-    unsigned int Renderer::memoryUsage() {
-        return this->memoryUsage_;
-    }
+    Drawable * Renderer::createStreamingTexture(const unsigned int width, const unsigned int height) {
+        SDL_Texture * tex = this->createTexture(width, height, true);
+        if (tex == nullptr) {
+            return new Drawable();
+        }
 
-    unsigned int Renderer::surfaceCount() {
-        return this->surfaceCount_;
+        return new Drawable(this, tex, width, height);
     }
 
-    unsigned int Renderer::textureCount() {
-        return this->textureCount_;
+    bool Renderer::updateStreamingTexture(Drawable * drawable, const uint8_t * pixels, const size_t pitch, const int x, const int y, const int w, const int h) {
+        // Sanity checks
+        if (drawable == nullptr || drawable->type() != Drawable::Type::Texture || pixels == nullptr || w <= 0 || h <= 0) {
+            this->logMessage("Couldn't update streaming texture: Invalid texture or area passed", true);
+            return false;
+        }
+
+        // Quads already queued (or pending) with this texture must show it's old contents
+        SDL_Texture * tex = drawable->data.texture;
+        if (this->pendingFrameUses(tex)) {
+            this->finishPendingFrame();
+        }
+        for (const DrawCommand & cmd : this->drawQueue) {
+            if (cmd.texture == tex) {
+                this->flushDrawQueue();
+                break;
+            }
+        }
+
+        SDL_Rect rect = {x, y, w, h};
+        if (SDL_UpdateTexture(tex, &rect, pixels + y*pitch + x*4, pitch) != 0) {
+            this->logMessage(std::string("Couldn't update streaming texture: ") + std::string(SDL_GetError()), true);
+            return false;
+        }
+        return true;
     }
 
-    unsigned int Renderer::windowWidth() {
-        return this->windowWidth_;
+    void Renderer::requestFrame() {
+        this->frameRequested_ = true;
     }
 
-    unsigned int Renderer::windowHeight() {
-        return this->windowHeight_;
+    bool Renderer::frameRequested() {
+        return this->frameRequested_.exchange(false);
     }
 
-    void Renderer::fillWindow(const Colour & col) {
-        // Sanity check (not logged as this will be called often)
-        if (this->renderer == nullptr) {
+    void Renderer::wakeUp() {
+        this->requestFrame();
+        if (this->wakeEvent == static_cast<uint32_t>(-1)) {
             return;
         }
 
-        if (col.a() == 255) {
-            SDL_SetRenderDrawColor(this->renderer, col.r(), col.g(), col.b(), col.a());
-            SDL_RenderClear(this->renderer);
-        } else {
-            this->drawFilledRect(col, 0, 0, this->windowWidth_, this->windowHeight_);
-        }
+        SDL_Event event;
+        SDL_zero(event);
+        event.type = this->wakeEvent;
+        SDL_PushEvent(&event);
     }
 
-    void Renderer::present() {
-        // Sleep if not initialized to prevent spinlock
-        if (this->renderer == nullptr) {
-            this->logMessage("Fatal error: SDL not initialized", true);
-            SDL_Delay(500);
-        }
-
-        SDL_RenderPresent(this->renderer);
+    bool Renderer::waitForEvent(const int timeout) {
+        // Show the last frame before sleeping
+        this->finishPendingFrame();
+        return (SDL_WaitEventTimeout(nullptr, timeout) == 1);
     }
 
     void Renderer::resetClipArea() {
-        // If we've only got one clip rectangle reset clip
-        if (this->clipStack.size() <= 1) {
-            SDL_RenderSetClipRect(this->renderer, nullptr);
-            if (!this->clipStack.empty()) {
-                delete this->clipStack.top();
-                this->clipStack.pop();
-            }
-
-        // Otherwise set to last rectangle
-        } else {
-            delete this->clipStack.top();
-            this->clipStack.pop();
-            SDL_Rect * r = this->clipStack.top();
-            SDL_RenderSetClipRect(this->renderer, r);
+        if (this->clipStack.depth > 0) {
+            this->clipStack.depth--;
         }
     }
 
     void Renderer::setClipArea(const int x1, const int y1, const int x2, const int y2) {
-        // Do nothing if the points are not in the correct order
-        if (x1 == x2 || y1 == y2 || x2 < x1 || y2 < y1) {
-            SDL_Rect * r = new SDL_Rect{0, 0, this->windowWidth_, this->windowHeight_};
-            this->clipStack.push(r);
+        // Only the top rectangle is ever used, so once full any more pushes are just counted
+        size_t depth = this->clipStack.depth;
+        this->clipStack.depth++;
+        if (depth >= maxClipDepth) {
+            if (depth == maxClipDepth) {
+                this->logMessage("Clip areas are nested too deeply, inner areas will be ignored", true);
+            }
             return;
         }
 
-        // Limit to within current clipping rectangle if we already have one active
-        SDL_Rect r;
-        if (!this->clipStack.empty()) {
-            SDL_RenderGetClipRect(this->renderer, &r);
-            int rx2 = r.x + r.w;
-            int ry2 = r.y + r.h;
-            r.x = (x1 < r.x ? r.x : x1);
-            r.y = (y1 < r.y ? r.y : y1);
-            rx2 = (x2 > rx2 ? rx2 : x2);
-            ry2 = (y2 > ry2 ? ry2 : y2);
-            r.w = rx2-r.x;
-            r.h = ry2-r.y;
-
-        // Otherwise use raw coordinates
-        } else {
-            r = SDL_Rect{x1, y1, x2-x1, y2-y1};
+        // Keep the current clip if the points are not in the correct order
+        Rect & r = this->clipStack.rects[depth];
+        if (x1 == x2 || y1 == y2 || x2 < x1 || y2 < y1) {
+            r = (depth == 0 ? Rect{-this->originX, -this->originY, static_cast<int>(this->windowWidth_), static_cast<int>(this->windowHeight_)} : this->clipStack.rects[depth - 1]);
+            return;
         }
 
-        // Make a copy on the heap
-        SDL_Rect * rr = new SDL_Rect{r.x, r.y, r.w, r.h};
+        // Clipping is tracked relative to the current target, limited to within the current clip
+        r = Rect{x1 - this->originX, y1 - this->originY, x2 - x1, y2 - y1};
+        if (depth > 0) {
+            const Rect & top = this->clipStack.rects[depth - 1];
+            int rx1 = std::max(r.x, top.x);
+            int ry1 = std::max(r.y, top.y);
+            int rx2 = std::min(r.x + r.w, top.x + top.w);
+            int ry2 = std::min(r.y + r.h, top.y + top.h);
+            r = Rect{rx1, ry1, std::max(rx2 - rx1, 0), std::max(ry2 - ry1, 0)};
+        }
+    }
 
-        // Set clip
-        int rc = SDL_RenderSetClipRect(this->renderer, rr);
-        if (rc == 0) {
-            this->clipStack.push(rr);
+    bool Renderer::clipped(const int x, const int y, const int w, const int h) {
+        if (this->clipStack.depth == 0) {
+            return false;
         }
+
+        const Rect & clip = this->clipStack.rects[std::min(this->clipStack.depth, maxClipDepth) - 1];
+        int cx = x - this->originX;
+        int cy = y - this->originY;
+        return (cx >= clip.x + clip.w || cx + w <= clip.x || cy >= clip.y + clip.h || cy + h <= clip.y);
     }
 
     void Renderer::setFont(const std::string & path) {
@@ -567,57 +2334,199 @@ namespace Aether {
         return std::make_tuple(lines, maxLineWidth, height);
     }
 
-    std::vector<Colour> Renderer::readSurfacePixels(SDL_Surface * surface) {
+    std::vector<uint8_t> Renderer::readSurfaceBytes(SDL_Surface * surface) {
         // Return empty vector if invalid surface
-        std::vector<Colour> pixels;
+        std::vector<uint8_t> pixels;
         if (surface == nullptr) {
             this->logMessage("Couldn't read pixels from surface: Null surface passed", true);
             return pixels;
         }
 
+        // Let SDL repack the whole surface at once
+        pixels.resize(surface->w * surface->h * 4);
         SDL_LockSurface(surface);
-        size_t count = surface->w * surface->h;
-        for (size_t i = 0; i < count; i++) {
-            // Get RGB values
-            uint8_t r, g, b, a;
-            SDL_GetRGBA(*((uint32_t *)surface->pixels + i), surface->format, &r, &g, &b, &a);
-
-            // Create object and push onto vector
-            pixels.push_back(Colour(r, g, b, a));
-        }
+        int rc = SDL_ConvertPixels(surface->w, surface->h, surface->format->format, surface->pixels, surface->pitch, SDL_PIXELFORMAT_RGBA32, pixels.data(), surface->w * 4);
         SDL_UnlockSurface(surface);
+        if (rc != 0) {
+            this->logMessage(std::string("Couldn't read pixels from surface: ") + std::string(SDL_GetError()), true);
+            pixels.clear();
+        }
 
         return pixels;
     }
 
-    std::vector<Colour> Renderer::readTexturePixels(SDL_Texture * texture) {
+    std::vector<uint8_t> Renderer::readTextureBytes(SDL_Texture * texture) {
         // Sanity check
-        std::vector<Colour> pixels;
+        std::vector<uint8_t> pixels;
         if (this->renderer == nullptr || texture == nullptr) {
             this->logMessage(std::string("Couldn't read pixels from texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Null texture passed"), true);
             return pixels;
         }
 
-        // Get number of pixels in texture
-        int w, h;
-        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+        // Anything queued may draw onto the texture, so submit it first
+        this->flushDrawQueue();
+
+        // Only render targets can be read back, so copy anything else onto a temporary one
+        // (restoring whatever was being drawn onto afterwards)
+        int access, w, h;
+        SDL_QueryTexture(texture, nullptr, &access, &w, &h);
+        SDL_Texture * previous = SDL_GetRenderTarget(this->renderer);
+        SDL_Texture * target = texture;
+        if (access != SDL_TEXTUREACCESS_TARGET) {
+            target = SDL_CreateTexture(this->renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, w, h);
+            if (target == nullptr) {
+                this->logMessage(std::string("Couldn't read pixels from texture: ") + std::string(SDL_GetError()), true);
+                return pixels;
+            }
 
-        // Read pixels into byte array
-        uint8_t * tmp = new uint8_t[w * h * 4];
-        if (SDL_RenderReadPixels(this->renderer, nullptr, SDL_PIXELFORMAT_RGBA32, &pixels[0], w * 4) < 0) {
-            this->logMessage("Couldn't read pixels from texture: Unable to read data", true);
-            return pixels;
+            // Copy without blending or tinting so the alpha channel is kept
+            SDL_BlendMode mode;
+            SDL_GetTextureBlendMode(texture, &mode);
+            SDL_SetRenderTarget(this->renderer, target);
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+            SDL_SetTextureColorMod(texture, 255, 255, 255);
+            SDL_SetTextureAlphaMod(texture, 255);
+            SDL_RenderCopy(this->renderer, texture, nullptr, nullptr);
+            SDL_SetTextureBlendMode(texture, mode);
+        } else {
+            SDL_SetRenderTarget(this->renderer, target);
         }
 
-        // Convert to Colour
-        for (size_t i = 0; i < w * h; i++) {
-            pixels.push_back(Colour(tmp[i], tmp[i+1], tmp[i+2], tmp[i+3]));
+        // Read the whole target in one go
+        pixels.resize(w * h * 4);
+        if (SDL_RenderReadPixels(this->renderer, nullptr, SDL_PIXELFORMAT_RGBA32, pixels.data(), w * 4) != 0) {
+            this->logMessage(std::string("Couldn't read pixels from texture: ") + std::string(SDL_GetError()), true);
+            pixels.clear();
         }
-        delete tmp;
 
+        SDL_SetRenderTarget(this->renderer, previous);
+        if (target != texture) {
+            SDL_DestroyTexture(target);
+        }
         return pixels;
     }
 
+    std::vector<Colour> Renderer::readSurfacePixels(SDL_Surface * surface) {
+        return toColours(this->readSurfaceBytes(surface));
+    }
+
+    std::vector<Colour> Renderer::readTexturePixels(SDL_Texture * texture) {
+        return toColours(this->readTextureBytes(texture));
+    }
+
+    ImageData Renderer::readFrame() {
+        // Make sure a pipelined frame has been drawn
+        this->finishPendingFrame();
+
+        // The window's backbuffer is undefined once presented, so only offscreen frames can be read
+        std::vector<uint8_t> pixels;
+        int w = 0, h = 0;
+        if (this->frameTexture != nullptr) {
+            SDL_QueryTexture(this->frameTexture, nullptr, nullptr, &w, &h);
+            pixels = this->readTextureBytes(this->frameTexture);
+
+        } else if (this->framebuffer != nullptr) {
+            w = this->framebuffer->w;
+            h = this->framebuffer->h;
+            pixels = this->readSurfaceBytes(this->framebuffer);
+
+        } else {
+            this->logMessage("Couldn't read frame: Frames aren't drawn offscreen", true);
+        }
+
+        if (pixels.empty()) {
+            return ImageData();
+        }
+        return ImageData(pixels, w, h, 4);
+    }
+
+    void Renderer::saveScreenshot(const std::string & path) {
+        this->screenshotPath = path;
+        this->requestFrame();
+    }
+
+    bool Renderer::startCapture(const std::string & directory, const CaptureFormat format) {
+        if (this->renderer == nullptr || directory.empty()) {
+            this->logMessage(std::string("Couldn't start capture: ") + std::string(this->renderer == nullptr ? "Renderer isn't initialized" : "No directory given"), true);
+            return false;
+        }
+
+        this->captureDir = directory;
+        this->captureFormat = format;
+        this->captureCount = 0;
+        this->droppedCaptures = 0;
+        this->capturing_ = true;
+        this->logMessage("Started capturing frames to " + directory, false);
+        return true;
+    }
+
+    void Renderer::stopCapture() {
+        // Let the thread pool finish writing what's been captured (including any screenshot)
+        bool wasCapturing = this->capturing_;
+        this->capturing_ = false;
+        while (this->pendingCaptures > 0) {
+            SDL_Delay(1);
+        }
+
+        if (wasCapturing) {
+            this->logMessage("Stopped capturing frames (" + std::to_string(this->captureCount) + " written, " + std::to_string(this->droppedCaptures) + " skipped)", false);
+        }
+    }
+
+    bool Renderer::capturing() {
+        return this->capturing_;
+    }
+
+    void Renderer::captureFrame() {
+        // Skip frames while encoding is behind rather than slowing down rendering,
+        // although a requested screenshot is always taken
+        bool screenshot = !this->screenshotPath.empty();
+        bool capture = this->capturing_;
+        if (capture && !screenshot && this->pendingCaptures >= maxPendingCaptures) {
+            this->droppedCaptures++;
+            return;
+        }
+
+        // Read the frame back from wherever it was drawn
+        int w, h;
+        if (this->frameTexture != nullptr) {
+            SDL_QueryTexture(this->frameTexture, nullptr, nullptr, &w, &h);
+            SDL_SetRenderTarget(this->renderer, this->frameTexture);
+        } else {
+            SDL_GetRendererOutputSize(this->renderer, &w, &h);
+        }
+
+        std::vector<uint8_t> pixels(w * h * 4);
+        SDL_RenderSetClipRect(this->renderer, nullptr);
+        int rc = SDL_RenderReadPixels(this->renderer, nullptr, SDL_PIXELFORMAT_RGBA32, pixels.data(), w * 4);
+        if (this->frameTexture != nullptr) {
+            SDL_SetRenderTarget(this->renderer, nullptr);
+        }
+        if (rc != 0) {
+            this->logMessage(std::string("Couldn't capture frame: ") + std::string(SDL_GetError()), true);
+            this->screenshotPath.clear();
+            return;
+        }
+
+        // Hand the pixels over to the thread pool to encode and write
+        if (screenshot) {
+            std::vector<uint8_t> copy = (capture ? pixels : std::vector<uint8_t>());
+            this->pendingCaptures++;
+            ThreadPool::getInstance()->queueJob(new CaptureJob(this, std::move(pixels), w, h, this->screenshotPath, CaptureFormat::PNG), ThreadPool::Importance::Normal);
+            this->screenshotPath.clear();
+            pixels = std::move(copy);
+        }
+        if (capture) {
+            std::string number = std::to_string(this->captureCount++);
+            number.insert(0, (number.length() < 6 ? 6 - number.length() : 0), '0');
+            std::string path = this->captureDir + "/frame_" + number;
+            path += (this->captureFormat == CaptureFormat::PNG ? ".png" : "_" + std::to_string(w) + "x" + std::to_string(h) + ".rgba");
+
+            this->pendingCaptures++;
+            ThreadPool::getInstance()->queueJob(new CaptureJob(this, std::move(pixels), w, h, path, this->captureFormat), ThreadPool::Importance::Normal);
+        }
+    }
+
     Drawable * Renderer::renderImageSurface(const std::string & path, const size_t scaleWidth, const size_t scaleHeight) {
         SDL_Surface * surf = nullptr;
         {
@@ -648,6 +2557,7 @@ namespace Aether {
         if (scaleWidth != 0 || scaleHeight != 0) {
             newSurf = this->scaleSurface(newSurf, scaleWidth, scaleHeight);
         }
+        this->markIfOpaque(newSurf);
 
         // Increment monitoring variables
         this->surfaceCount_++;
@@ -686,6 +2596,7 @@ namespace Aether {
         if (scaleWidth != 0 || scaleHeight != 0) {
             newSurf = this->scaleSurface(newSurf, scaleWidth, scaleHeight);
         }
+        this->markIfOpaque(newSurf);
 
         // Increment monitoring variables
         this->surfaceCount_++;
@@ -804,176 +2715,155 @@ namespace Aether {
         return new Drawable(this, surf, surf->w, surf->h);
     }
 
-    Drawable * Renderer::renderEllipseTexture(const unsigned int rx, const unsigned int ry, const unsigned int thick) {
-        // Sanity check
-        if (this->renderer == nullptr || rx == 0 || ry == 0 || thick == 0) {
-            this->logMessage(std::string("Couldn't render ellipse texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
-            return new Drawable();
+    SDL_Surface * Renderer::rasterizeShape(const int width, const int height, const float rx, const float ry, const float thick) {
+        // Create a surface to draw into
+        SDL_Surface * surf = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (surf == nullptr) {
+            this->logMessage(std::string("Couldn't create surface for shape: ") + std::string(SDL_GetError()), true);
+            return nullptr;
         }
 
-        // Create texture
-        unsigned int width = 2 * (rx + thick);
-        unsigned int height = 2 * (ry + thick);
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render ellipse texture: Null texture returned", true);
-            return new Drawable();
-        }
+        // Rasterize directly into the pixel data
+        SDL_LockSurface(surf);
+        uint8_t * pixels = static_cast<uint8_t *>(surf->pixels);
+        Utils::Rasterizer::clear(pixels, surf->w, surf->h, surf->pitch);
+        Utils::Rasterizer::drawRoundRect(pixels, surf->w, surf->h, surf->pitch, rx, ry, thick);
+        SDL_UnlockSurface(surf);
 
-        // Render ellipse
-        this->renderOnTexture(tex, [rx, ry, thick](SDL_Renderer * renderer) {
-            // Drawing in quadrants is faster than the full 360 degrees
-            for (unsigned short i = 0; i < 4; i++) {
-                aaArcRGBA(renderer, rx + thick, ry + thick, rx + thick/2, ry + thick/2, i*90, (i+1)*90 + 1, thick, 255, 255, 255, 255);
-            }
-        });
+        // Increment monitoring variables
+        this->surfaceCount_++;
+        this->memoryUsage_ += (surf->pitch * surf->h);
 
-        return new Drawable(this, tex, width, height);
+        return surf;
     }
 
-    Drawable * Renderer::renderFilledEllipseTexture(const unsigned int rx, const unsigned int ry) {
-        // Sanity check
-        if (this->renderer == nullptr || rx == 0 || ry == 0) {
-            this->logMessage(std::string("Couldn't render filled ellipse texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
-            return new Drawable();
+    Drawable * Renderer::renderShape(const int width, const int height, const float rx, const float ry, const float thick) {
+        ShapeKey key = {width, height, rx, ry, thick};
+
+        // Share the existing texture if this shape has already been rendered
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            std::map<ShapeKey, CachedShape>::iterator it = this->shapeCache.find(key);
+            if (it != this->shapeCache.end()) {
+                it->second.refs++;
+                this->shapeCacheHits_++;
+                return new Drawable(this, it->second.texture, width, height);
+            }
         }
 
-        // Create texture
-        unsigned int width = 2 * rx;
-        unsigned int height = 2 * ry;
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render filled ellipse texture: Null texture returned", true);
+        // Otherwise rasterize it, remembering the surface is for this shape so it's cached once converted
+        this->shapeCacheMisses_++;
+        SDL_Surface * surf = this->rasterizeShape(width, height, rx, ry, thick);
+        if (surf == nullptr) {
             return new Drawable();
         }
 
-        // Render filled ellipse
-        this->renderOnTexture(tex, [rx, ry](SDL_Renderer * renderer) {
-            aaFilledEllipseRGBA(renderer, rx, ry, rx, ry, 255, 255, 255, 255);
-        });
-
-        return new Drawable(this, tex, width, height);
+        {
+            std::scoped_lock<std::mutex> mtx(this->shapeMtx);
+            this->pendingShapes[surf] = key;
+        }
+        return new Drawable(this, surf, width, height);
     }
 
-    Drawable * Renderer::renderRectTexture(const int width, const int height, const unsigned int thick) {
+    Drawable * Renderer::renderEllipseSurface(const unsigned int rx, const unsigned int ry, const unsigned int thick) {
         // Sanity check
-        if (this->renderer == nullptr || width == 0 || height == 0 || thick == 0) {
-            this->logMessage(std::string("Couldn't render rectangle texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
-            return new Drawable();
-        }
-
-        // Create texture
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render rectangle texture: Null texture returned", true);
+        if (this->renderer == nullptr || rx == 0 || ry == 0 || thick == 0) {
+            this->logMessage(std::string("Couldn't render ellipse surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Render rectangle
-        this->renderOnTexture(tex, [width, height, thick](SDL_Renderer * renderer) {
-            for (unsigned int i = 0; i < thick; i++) {
-                rectangleRGBA(renderer, width - i, i, i, height - i, 255, 255, 255, 255);
-            }
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        });
-
-        return new Drawable(this, tex, width, height);
+        // Outline is drawn outside of the given radii
+        int width = 2 * (rx + thick);
+        int height = 2 * (ry + thick);
+        return this->renderShape(width, height, rx + thick, ry + thick, thick);
     }
 
-    Drawable * Renderer::renderFilledRectTexture(const int width, const int height) {
+    Drawable * Renderer::renderFilledEllipseSurface(const unsigned int rx, const unsigned int ry) {
         // Sanity check
-        if (this->renderer == nullptr || width == 0 || height == 0) {
-            this->logMessage(std::string("Couldn't render filled rectangle texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
+        if (this->renderer == nullptr || rx == 0 || ry == 0) {
+            this->logMessage(std::string("Couldn't render filled ellipse surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Create texture
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render filled rectangle texture: Null texture returned", true);
+        int width = 2 * rx;
+        int height = 2 * ry;
+        return this->renderShape(width, height, rx, ry, 0);
+    }
+
+    Drawable * Renderer::renderRectSurface(const int width, const int height, const unsigned int thick) {
+        // Sanity check
+        if (this->renderer == nullptr || width <= 0 || height <= 0 || thick == 0) {
+            this->logMessage(std::string("Couldn't render rectangle surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Render rectangle
-        this->renderOnTexture(tex, [width, height](SDL_Renderer * renderer) {
-            SDL_Rect r = {0, 0, width, height};
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-            SDL_RenderFillRect(renderer, &r);
-        });
-
-        return new Drawable(this, tex, width, height);
+        return this->renderShape(width, height, 0, 0, thick);
     }
 
-    Drawable * Renderer::renderRoundRectTexture(const int width, const int height, const unsigned int radius, const unsigned int thick) {
+    Drawable * Renderer::renderFilledRectSurface(const int width, const int height) {
         // Sanity check
-        if (this->renderer == nullptr || width == 0 || height == 0 || radius == 0 || thick == 0) {
-            this->logMessage(std::string("Couldn't render round rectangle texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
+        if (this->renderer == nullptr || width <= 0 || height <= 0) {
+            this->logMessage(std::string("Couldn't render filled rectangle surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Create texture
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render round rectangle texture: Null texture returned", true);
+        return this->renderShape(width, height, 0, 0, 0);
+    }
+
+    Drawable * Renderer::renderRoundRectSurface(const int width, const int height, const unsigned int radius, const unsigned int thick) {
+        // Sanity check
+        if (this->renderer == nullptr || width <= 0 || height <= 0 || radius == 0 || thick == 0) {
+            this->logMessage(std::string("Couldn't render round rectangle surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Render round rectangle
-        this->renderOnTexture(tex, [width, height, radius, thick](SDL_Renderer * renderer) {
-            // Starting with top left corner, moving clockwise
-            aaArcRGBA(renderer, radius        , radius         , radius - thick/2.0, radius - thick/2.0, 180, 270, thick, 255, 255, 255, 255);
-            aaArcRGBA(renderer, width - radius, radius         , radius - thick/2.0, radius - thick/2.0, 270, 360, thick, 255, 255, 255, 255);
-            aaArcRGBA(renderer, width - radius, height - radius, radius - thick/2.0, radius - thick/2.0,   0,  90, thick, 255, 255, 255, 255);
-            aaArcRGBA(renderer, radius        , height - radius, radius - thick/2.0, radius - thick/2.0,  90, 180, thick, 255, 255, 255, 255);
-
-            // Join with lines (starting at top, clockwise)
-            thickLineRGBA(renderer, radius           , thick/2.0         , width - radius   , thick/2.0         , thick, 255, 255, 255, 255);
-            thickLineRGBA(renderer, width - thick/2.0, radius            , width - thick/2.0, height - radius   , thick, 255, 255, 255, 255);
-            thickLineRGBA(renderer, radius           , height - thick/2.0, width - radius   , height - thick/2.0, thick, 255, 255, 255, 255);
-            thickLineRGBA(renderer, thick/2.0        , radius            , thick/2.0        , height - radius   , thick, 255, 255, 255, 255);
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-        });
-
-        return new Drawable(this, tex, width, height);
+        return this->renderShape(width, height, radius, radius, thick);
     }
 
-    Drawable * Renderer::renderFilledRoundRectTexture(const int width, const int height, const unsigned int radius) {
+    Drawable * Renderer::renderFilledRoundRectSurface(const int width, const int height, const unsigned int radius) {
         // Sanity check
-        if (this->renderer == nullptr || width == 0 || height == 0 || radius == 0) {
-            this->logMessage(std::string("Couldn't render filled round rectangle texture: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
+        if (this->renderer == nullptr || width <= 0 || height <= 0 || radius == 0) {
+            this->logMessage(std::string("Couldn't render filled round rectangle surface: ") + (this->renderer == nullptr ? "Renderer isn't initialized" : "Invalid values"), true);
             return new Drawable();
         }
 
-        // Create texture
-        SDL_Texture * tex = createTexture(width, height);
-        if (tex == nullptr) {
-            this->logMessage("Couldn't render filled round rectangle texture: Null texture returned", true);
-            return new Drawable();
-        }
+        return this->renderShape(width, height, radius, radius, 0);
+    }
 
-        // Render round rectangle
-        this->renderOnTexture(tex, [width, height, radius](SDL_Renderer * renderer) {
-            // Starting with top left corner, moving clockwise
-            aaFilledPieRGBA(renderer, radius        , radius         , radius, radius, 180, 270, 0, 255, 255, 255, 255);
-            aaFilledPieRGBA(renderer, width - radius, radius         , radius, radius, 270, 360, 0, 255, 255, 255, 255);
-            aaFilledPieRGBA(renderer, width - radius, height - radius, radius, radius,   0,  90, 0, 255, 255, 255, 255);
-            aaFilledPieRGBA(renderer, radius        , height - radius, radius, radius,  90, 180, 0, 255, 255, 255, 255);
+    Drawable * Renderer::renderEllipseTexture(const unsigned int rx, const unsigned int ry, const unsigned int thick) {
+        Drawable * drawable = this->renderEllipseSurface(rx, ry, thick);
+        drawable->convertToTexture();
+        return drawable;
+    }
 
-            // Fill in with rectangles (left to right)
-            SDL_Rect r;
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    Drawable * Renderer::renderFilledEllipseTexture(const unsigned int rx, const unsigned int ry) {
+        Drawable * drawable = this->renderFilledEllipseSurface(rx, ry);
+        drawable->convertToTexture();
+        return drawable;
+    }
 
-            r = {0, radius, radius, height - 2*radius};
-            SDL_RenderFillRect(renderer, &r);
+    Drawable * Renderer::renderRectTexture(const int width, const int height, const unsigned int thick) {
+        Drawable * drawable = this->renderRectSurface(width, height, thick);
+        drawable->convertToTexture();
+        return drawable;
+    }
 
-            r = {radius, 0, width - 2*radius, height};
-            SDL_RenderFillRect(renderer, &r);
+    Drawable * Renderer::renderFilledRectTexture(const int width, const int height) {
+        Drawable * drawable = this->renderFilledRectSurface(width, height);
+        drawable->convertToTexture();
+        return drawable;
+    }
 
-            r = {width - radius, radius, radius, height - 2*radius};
-            SDL_RenderFillRect(renderer, &r);
-        });
+    Drawable * Renderer::renderRoundRectTexture(const int width, const int height, const unsigned int radius, const unsigned int thick) {
+        Drawable * drawable = this->renderRoundRectSurface(width, height, radius, thick);
+        drawable->convertToTexture();
+        return drawable;
+    }
 
-        return new Drawable(this, tex, width, height);
+    Drawable * Renderer::renderFilledRoundRectTexture(const int width, const int height, const unsigned int radius) {
+        Drawable * drawable = this->renderFilledRoundRectSurface(width, height, radius);
+        drawable->convertToTexture();
+        return drawable;
     }
 
     Renderer::~Renderer() {
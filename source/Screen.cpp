@@ -5,6 +5,11 @@
 
 namespace Aether {
     Screen::Screen() : Container(0, 0, 1280, 720) {
+        // Fill the window if it's already been created
+        if (Element::renderer != nullptr) {
+            this->setWH(Element::renderer->windowWidth(), Element::renderer->windowHeight());
+        }
+
         // Init all handlers to nullptr to indicate none set
         for (int i = Button::A; i < Button::SR_RIGHT; i++) {
             this->onButtonPressFuncs[static_cast<Button>(i)] = nullptr;
@@ -79,6 +79,12 @@ namespace Aether {
             }
         }
         this->workers.clear();
+
+        // Delete any jobs which never got to run
+        for (std::pair<Job *, int> & job : this->jobs) {
+            delete job.first;
+        }
+        this->jobs.clear();
     }
 
     ThreadPool * ThreadPool::getInstance() {
@@ -146,4 +152,17 @@ namespace Aether {
             return;
         }
     }
+
+    bool ThreadPool::removeJob(int id) {
+        std::scoped_lock<std::mutex> mtx(this->jobsMutex);
+        for (size_t i = 0; i < this->jobs.size(); i++) {
+            if (this->jobs[i].second == id) {
+                delete this->jobs[i].first;
+                this->jobs.erase(this->jobs.begin() + i);
+                return true;
+            }
+        }
+
+        return false;
+    }
 }
@@ -1,3 +1,4 @@
+#include "Aether/base/Texture.hpp"
 #include "Aether/Overlay.hpp"
 #include "Aether/Screen.hpp"
 #include "Aether/ThreadPool.hpp"
@@ -20,8 +21,14 @@ static constexpr int defaultMarkHeldDelay = 400;
 // Amount to vary fade alpha by per second
 static constexpr short fadeDelta = 800;
 
+// Default longest time to wait for an event when idle (1 second)
+static constexpr int defaultIdleTimeout = 1000;
+
+// Time each frame advances by when headless (60 frames per second)
+static constexpr double headlessTimestep = 1000.0/60.0;
+
 namespace Aether {
-    Window::Window(const std::string & name, const unsigned int width, const unsigned int height, const LogHandler & log) {
+    Window::Window(const std::string & name, const unsigned int width, const unsigned int height, const LogHandler & log, const PresentMode mode, const std::string & driver, const bool headless) {
         // Initially have a black background
         this->bgColour = Colour(0, 0, 0, 255);
         this->bgDrawable = new Drawable();
@@ -32,8 +39,15 @@ namespace Aether {
         this->fade.in = false;
         this->fade.out = false;
         this->showDebug = false;
+        this->debugArea = {0, 0, 0, 0};
+        this->idleMode = false;
+        this->idleTimeout = defaultIdleTimeout;
+        this->freezeScreen = false;
+        this->snapshot = nullptr;
+        this->snapshotStale = true;
         this->lastMillis = 0;
         this->timer = nullptr;
+        this->fixedTimestep = (headless ? headlessTimestep : 0);
 
         // No button is held down initially
         this->heldButton = Button::NO_BUTTON;
@@ -53,13 +67,18 @@ namespace Aether {
         this->screen = nullptr;
         Element::renderer = new Renderer();
         Element::renderer->setLogHandler(log);
-        this->shouldLoop = Element::renderer->initialize(name, width, height);
+        this->shouldLoop = Element::renderer->initialize(name, width, height, mode, driver, headless);
 
         // Create our thread pool
         log("Created a thread pool with size " + std::to_string(ThreadPool::getInstance()->maxConcurrentJobs()), false);
     }
 
     void Window::performScreenOps() {
+        // The whole window changes when the screen does
+        if (!this->screenOps.empty()) {
+            Element::renderer->damageAll();
+        }
+
         while (!this->screenOps.empty()) {
             std::pair<ScreenOperation, Screen *> item = this->screenOps.front();
             switch (item.first) {
@@ -87,6 +106,7 @@ namespace Aether {
                     }
                     this->screen = item.second;
                     if (this->screen != nullptr) {
+                        this->screen->setWH(Element::renderer->windowWidth(), Element::renderer->windowHeight());
                         this->screen->onLoad();
                     }
                     break;
@@ -95,6 +115,15 @@ namespace Aether {
         }
     }
 
+    bool Window::isIdle() {
+        // Always check for a request first so it is cleared
+        if (Element::renderer->frameRequested()) {
+            return false;
+        }
+
+        return (this->heldButton == Button::NO_BUTTON && this->fade.action == FadeAction::None && this->screenOps.empty());
+    }
+
     void Window::processEvents() {
         SDL_Event e;
         while (SDL_PollEvent(&e)) {
@@ -118,8 +147,8 @@ namespace Aether {
 
                     } else {
                         event2.type = (e.type == SDL_MOUSEBUTTONUP ? SDL_FINGERUP : SDL_FINGERDOWN);
-                        event2.tfinger.x = (e.button.x/(float)Element::renderer->windowWidth());
-                        event2.tfinger.y = (e.button.y/(float)Element::renderer->windowHeight());
+                        event2.tfinger.x = (e.button.x/(float)Element::renderer->outputWidth());
+                        event2.tfinger.y = (e.button.y/(float)Element::renderer->outputHeight());
                         event2.tfinger.dy = 0;
                         event2.tfinger.dx = 0;
                     }
@@ -133,11 +162,15 @@ namespace Aether {
                 case SDL_FINGERMOTION:
                 case SDL_FINGERUP:
                     // Create InputEvent and pass to screen/overlay
-                    InputEvent * event = new InputEvent(e);
+                    InputEvent * event = new InputEvent(e, Element::renderer->windowWidth(), Element::renderer->windowHeight());
 
                     // Set touched variable
                     bool old = Element::isTouch;
                     Element::isTouch = (event->button() == Button::NO_BUTTON);
+                    if (old != Element::isTouch) {
+                        Element::layerGeneration++;
+                        Element::renderer->damageAll();
+                    }
 
                     // Ignore first directional press or A (ie. only highlight)
                     if (old == true && Element::isTouch == false && ((event->id() != FAKE_ID && (event->button() >= DPAD_LEFT && event->button() <= DPAD_DOWN)) || (event->button() == A))) {
@@ -146,6 +179,10 @@ namespace Aether {
                     }
 
                     if (event->id() == FAKE_ID && (event->button() < DPAD_LEFT || event->button() > DPAD_DOWN)) {
+                        if (!Element::isTouch) {
+                            Element::layerGeneration++;
+                            Element::renderer->damageAll();
+                        }
                         Element::isTouch = true;
                     }
 
@@ -172,6 +209,13 @@ namespace Aether {
         }
     }
 
+    void Window::renderScreen() {
+        // Clear screen and render image if needed
+        Element::renderer->fillWindow(this->bgColour);
+        this->bgDrawable->render(0, 0, Element::renderer->windowWidth(), Element::renderer->windowHeight());
+        this->screen->draw();
+    }
+
     void Window::renderDebug(const double delta) {
         size_t fps = static_cast<size_t>(1.0/(delta/1000.0));
 
@@ -179,17 +223,30 @@ namespace Aether {
         std::string text = "FPS: " + std::to_string(fps) + " (" + std::to_string(static_cast<int>(delta)) + " ms)\n";
         text += "Mem: " + std::to_string(Element::renderer->memoryUsage()/1024) + " KB\n";
         text += "Surf: " + std::to_string(Element::renderer->surfaceCount()) + "\n";
-        text += "Tex: " + std::to_string(Element::renderer->textureCount());
+        text += "Tex: " + std::to_string(Element::renderer->textureCount()) + "\n";
+        unsigned int poolHits = Element::renderer->texturePoolHits();
+        unsigned int poolTotal = poolHits + Element::renderer->texturePoolMisses();
+        text += "Pool: " + std::to_string(poolTotal == 0 ? 0 : (100 * poolHits)/poolTotal) + "% (" + std::to_string(Element::renderer->texturePoolMemory()/1024) + " KB idle)";
 
         // Render and position at bottom left
         Drawable * info = Element::renderer->renderWrappedTextSurface(text, debugFontSize, 350);
         info->convertToTexture();
         info->setColour(Colour(0, 200, 200, 200));
-        info->render(5, Element::renderer->windowHeight() - info->height() - 5);
+        int y = Element::renderer->windowHeight() - info->height() - 5;
+
+        // Redraw wherever the text was last frame as well, in case it shrunk
+        Element::renderer->addDamage(this->debugArea.x, this->debugArea.y, this->debugArea.w, this->debugArea.h);
+        this->debugArea = {5, y, static_cast<int>(info->width()), static_cast<int>(info->height())};
+        Element::renderer->addDamage(this->debugArea.x, this->debugArea.y, this->debugArea.w, this->debugArea.h);
+        info->render(5, y);
         delete info;
     }
 
     void Window::renderFade(const double delta) {
+        if (this->fade.action != FadeAction::None) {
+            Element::renderer->damageAll();
+        }
+
         switch (this->fade.action) {
             case FadeAction::None:
                 break;
@@ -249,6 +306,7 @@ namespace Aether {
             }
 
             // Otherwise remove from the vector
+            Element::renderer->damageAll();
             this->overlays.erase(this->overlays.begin() + i);
             if (this->overlays.size() == 0) {
                 this->screen->setActive();
@@ -259,9 +317,108 @@ namespace Aether {
     }
 
     void Window::showDebugInfo(const bool show) {
+        // Remove the overlay from the screen when hidden
+        if (!show) {
+            Element::renderer->addDamage(this->debugArea.x, this->debugArea.y, this->debugArea.w, this->debugArea.h);
+            this->debugArea = {0, 0, 0, 0};
+        }
         this->showDebug = show;
     }
 
+    bool Window::setDamageTracking(const bool enable) {
+        return Element::renderer->setDamageTracking(enable);
+    }
+
+    void Window::setIdleMode(const bool enable, const int timeout) {
+        this->idleMode = enable;
+        this->idleTimeout = timeout;
+        Element::renderer->requestFrame();
+    }
+
+    void Window::setFreezeBehindOverlays(const bool freeze) {
+        this->freezeScreen = freeze;
+        this->snapshotStale = true;
+        if (!freeze) {
+            delete this->snapshot;
+            this->snapshot = nullptr;
+        }
+        Element::renderer->damageAll();
+    }
+
+    bool Window::setPresentMode(const PresentMode mode, const unsigned int fps) {
+        if (mode == PresentMode::Limited) {
+            Element::renderer->setFrameLimit(fps);
+        }
+        return Element::renderer->setPresentMode(mode);
+    }
+
+    bool Window::setLogicalSize(const unsigned int width, const unsigned int height) {
+        if (!Element::renderer->setLogicalSize(width, height)) {
+            return false;
+        }
+
+        // Anything sized to the old area needs to be recreated
+        if (this->screen != nullptr) {
+            this->screen->setWH(width, height);
+        }
+        delete this->snapshot;
+        this->snapshot = nullptr;
+        this->snapshotStale = true;
+        return true;
+    }
+
+    void Window::setUploadBudget(const size_t bytes) {
+        Element::renderer->setUploadBudget(bytes);
+    }
+
+    void Window::setTexturePoolLimit(const size_t bytes) {
+        Element::renderer->setTexturePoolLimit(bytes);
+    }
+
+    void Window::setTextureBudget(const size_t bytes) {
+        Element::renderer->setTextureBudget(bytes);
+    }
+
+    void Window::setTextureAtlasSize(const unsigned int size) {
+        Element::renderer->setAtlasPageSize(size);
+    }
+
+    void Window::setLowMemoryTextures(const bool enable) {
+        Element::renderer->setLowMemoryTextures(enable);
+    }
+
+    void Window::setPipelinedRendering(const bool enable) {
+        Element::renderer->setPipelined(enable);
+    }
+
+    void Window::setFixedTimestep(const double millis) {
+        this->fixedTimestep = (millis > 0 ? millis : 0);
+    }
+
+    ImageData Window::readFrame() {
+        return Element::renderer->readFrame();
+    }
+
+    FrameStats Window::frameStats() {
+        return Element::renderer->frameStats();
+    }
+
+    void Window::saveScreenshot(const std::string & path) {
+        Element::renderer->saveScreenshot(path);
+    }
+
+    bool Window::startCapture(const std::string & directory, const CaptureFormat format) {
+        return Element::renderer->startCapture(directory, format);
+    }
+
+    void Window::stopCapture() {
+        Element::renderer->stopCapture();
+    }
+
+    bool Window::setRenderScale(const float scale) {
+        return Element::renderer->setRenderScale(scale);
+    }
+
     void Window::setFadeIn(const bool fade) {
         this->fade.in = fade;
     }
@@ -272,6 +429,7 @@ namespace Aether {
 
     void Window::setBackgroundColour(const Colour & col) {
         this->bgColour = col;
+        Element::renderer->damageAll();
     }
 
     bool Window::setBackgroundImage(const std::string & path) {
@@ -279,6 +437,7 @@ namespace Aether {
         if (path.empty()) {
             delete this->bgDrawable;
             this->bgDrawable = new Drawable();
+            Element::renderer->damageAll();
             return true;
         }
 
@@ -292,6 +451,7 @@ namespace Aether {
         // If all succeeded, actually replace the current image
         delete this->bgDrawable;
         this->bgDrawable = tmp;
+        Element::renderer->damageAll();
         return true;
     }
 
@@ -309,14 +469,20 @@ namespace Aether {
         }
 
         this->highlight = func;
+        Element::layerGeneration++;
+        Element::renderer->damageAll();
     }
 
     void Window::setHighlightBackground(const Colour & col) {
         Element::hiBGColour = col;
+        Element::layerGeneration++;
+        Element::renderer->damageAll();
     }
 
     void Window::setHighlightOverlay(const Colour & col) {
         Element::selColour = col;
+        Element::layerGeneration++;
+        Element::renderer->damageAll();
     }
 
     int Window::holdDelay() {
@@ -332,6 +498,7 @@ namespace Aether {
         ovl->reuse();
 
         // Add to vector and make it the active layer
+        Element::renderer->damageAll();
         this->overlays.push_back(ovl);
         this->screen->setInactive();
         if (this->overlays.size() > 1) {
@@ -379,26 +546,61 @@ namespace Aether {
             return false;
         }
 
+        // Wait for something to happen if nothing changed last frame
+        if (this->idleMode && this->isIdle()) {
+            Element::renderer->waitForEvent(this->idleTimeout);
+            if (this->fixedTimestep <= 0) {
+                this->lastMillis = this->timer->elapsedMillis();
+            }
+        }
+
         // Check for events and pass to active layer
         this->processEvents();
 
         // Get the time since last frame and update our state
-        double millis = this->timer->elapsedMillis();
+        double millis = (this->fixedTimestep > 0 ? this->lastMillis + this->fixedTimestep : this->timer->elapsedMillis());
         double delta = millis - this->lastMillis;
         this->lastMillis = millis;
-        this->screen->update(delta);
+
+        // The screen doesn't change while frozen behind an overlay
+        bool frozen = (this->freezeScreen && !this->overlays.empty());
+        if (!frozen) {
+            this->screen->update(delta);
+        }
         this->updateHeldButton(delta);
         this->updateOverlays(delta);
-        Element::hiBorderColour = this->highlight(millis);
+        Colour hiColour = this->highlight(millis);
+        if (hiColour.r() != Element::hiBorderColour.r() || hiColour.g() != Element::hiBorderColour.g() || hiColour.b() != Element::hiBorderColour.b() || hiColour.a() != Element::hiBorderColour.a()) {
+            // The highlight border is drawn by the last element to render it
+            if (Element::hiOwner != nullptr && Element::hiOwner->highlighted() && !Element::isTouch) {
+                Element::hiOwner->invalidate();
+            }
+        }
+        Element::hiBorderColour = hiColour;
 
-        // Clear screen and render image if needed
-        Element::renderer->fillWindow(this->bgColour);
-        this->bgDrawable->render(0, 0, Element::renderer->windowWidth(), Element::renderer->windowHeight());
+        // Capture the screen once when it becomes frozen
+        if (frozen && this->snapshotStale) {
+            if (this->snapshot == nullptr) {
+                this->snapshot = Element::renderer->createLayer(Element::renderer->windowWidth(), Element::renderer->windowHeight());
+            }
 
-        // Present screen and then overlays on top
-        this->screen->render();
+            if (this->snapshot->type() == Drawable::Type::Texture && Element::renderer->beginLayer(this->snapshot, 0, 0)) {
+                this->renderScreen();
+                Element::renderer->endLayer();
+                this->snapshotStale = false;
+            }
+        }
+
+        // Draw the screen (or it's snapshot, which still shows the screen's textures) and then overlays on top
+        if (frozen && !this->snapshotStale) {
+            this->snapshot->render(0, 0);
+            this->screen->markDrawn(Element::renderer->frameCount());
+        } else {
+            this->renderScreen();
+            this->snapshotStale = true;
+        }
         for (Overlay * ovl : this->overlays) {
-            ovl->render();
+            ovl->draw();
         }
 
         // Render debug information and fade rectangle on very top
@@ -407,8 +609,9 @@ namespace Aether {
         }
         this->renderFade(delta);
 
-        // Present the framebuffer and return
+        // Present the framebuffer, then free memory if over budget
         Element::renderer->present();
+        Texture::enforceTextureBudget();
         return this->shouldLoop;
     }
 
@@ -430,9 +633,12 @@ namespace Aether {
         Element::hiBorderTex = nullptr;
         Element::selTex = nullptr;
 
-        // Stop running threads + clean up renderer
+        // Finish writing captured frames while the threads are still running,
+        // then stop running threads + clean up renderer
+        Element::renderer->stopCapture();
         delete ThreadPool::getInstance();
         delete this->bgDrawable;
+        delete this->snapshot;
         Element::renderer->cleanup();
         delete Element::renderer;
 
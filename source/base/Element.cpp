@@ -19,12 +19,17 @@ namespace Aether {
     Element * Element::hiOwner = nullptr;
     Element * Element::selOwner = nullptr;
     bool Element::isTouch = false;
+    unsigned int Element::layerGeneration = 0;
 
     Element::Element(int x, int y, int w, int h) {
+        this->x_ = 0;
+        this->y_ = 0;
+        this->w_ = 0;
+        this->h_ = 0;
+        this->hidden_ = false;
         this->setXYWH(x, y, w, h);
 
         this->parent_ = nullptr;
-        this->hidden_ = false;
         this->onPressFunc_ = nullptr;
         this->hasSelectable_ = false;
         this->selectable_ = false;
@@ -33,6 +38,10 @@ namespace Aether {
         this->selected_ = false;
         this->hasSelected_ = false;
         this->touchable_ = false;
+        this->cacheAsLayer_ = false;
+        this->layer = nullptr;
+        this->layerDirty = true;
+        this->layerDrawnGeneration = 0;
 
         this->focused_ = nullptr;
     }
@@ -81,26 +90,50 @@ namespace Aether {
 
     void Element::setX(int x) {
         int diff = x - this->x();
+        if (diff != 0) {
+            this->invalidate();
+        }
         this->x_ = x;
         for (size_t i = 0; i < this->children.size(); i++) {
             this->children[i]->setX(this->children[i]->x() + diff);
         }
+        if (diff != 0) {
+            this->invalidate();
+        }
     }
 
     void Element::setY(int y) {
         int diff = y - this->y();
+        if (diff != 0) {
+            this->invalidate();
+        }
         this->y_ = y;
         for (size_t i = 0; i < this->children.size(); i++) {
             this->children[i]->setY(this->children[i]->y() + diff);
         }
+        if (diff != 0) {
+            this->invalidate();
+        }
     }
 
     void Element::setW(int w) {
+        if (w == this->w_) {
+            return;
+        }
+
+        this->invalidate();
         this->w_ = w;
+        this->invalidate();
     }
 
     void Element::setH(int h) {
+        if (h == this->h_) {
+            return;
+        }
+
+        this->invalidate();
         this->h_ = h;
+        this->invalidate();
     }
 
     void Element::setXY(int x, int y) {
@@ -145,11 +178,13 @@ namespace Aether {
             this->setHasHighlighted(true);
         }
         this->children.insert(this->children.begin() + i, e);
+        e->invalidate();
     }
 
     bool Element::removeElement(Element * e) {
         std::vector<Element *>::iterator it = std::find(this->children.begin(), this->children.end(), e);
         if (it != this->children.end()) {
+            (*it)->invalidate();
             delete (*it);
             this->children.erase(it);
             return true;
@@ -159,6 +194,7 @@ namespace Aether {
 
     void Element::removeAllElements() {
         for (size_t i = 0; i < this->children.size(); i++) {
+            this->children[i]->invalidate();
             delete this->children[i];
         }
         this->children.clear();
@@ -167,6 +203,7 @@ namespace Aether {
     bool Element::returnElement(Element * e) {
         std::vector<Element *>::iterator it = std::find(this->children.begin(), this->children.end(), e);
         if (it != this->children.end()) {
+            e->invalidate();
             this->children.erase(it);
             e->setParent(nullptr);
             return true;
@@ -176,25 +213,118 @@ namespace Aether {
 
     void Element::returnAllElements() {
         for (size_t i = 0; i < this->children.size(); i++) {
+            this->children[i]->invalidate();
             this->children[i]->setParent(nullptr);
         }
         this->children.clear();
     }
 
     bool Element::isVisible() {
-        if (this->hidden_ || this->x() > 1280 || this->x() + this->w() < 0 || this->y() > 720 || this->y() + this->h() < 0) {
+        // Compare against the window's logical size, which everything is positioned within
+        int width = (Element::renderer != nullptr ? Element::renderer->windowWidth() : 1280);
+        int height = (Element::renderer != nullptr ? Element::renderer->windowHeight() : 720);
+        if (this->hidden_ || this->x() > width || this->x() + this->w() < 0 || this->y() > height || this->y() + this->h() < 0) {
             return false;
         }
 
         return true;
     }
 
+    void Element::invalidate() {
+        if (this->renderer == nullptr || this->hidden_) {
+            return;
+        }
+
+        // Any cached layer containing this element needs redrawing
+        for (Element * e = this; e != nullptr; e = e->parent_) {
+            if (e->cacheAsLayer_) {
+                e->layerDirty = true;
+            }
+        }
+
+        // Include the highlight border, which is drawn outside of the element
+        int border = this->hiSize;
+        this->renderer->addDamage(this->x_ - border, this->y_ - border, this->w_ + 2*border, this->h_ + 2*border);
+    }
+
+    void Element::requestFrame() {
+        if (this->renderer != nullptr) {
+            this->renderer->requestFrame();
+        }
+    }
+
+    void Element::setCacheAsLayer(const bool cache) {
+        this->cacheAsLayer_ = cache;
+        this->layerDirty = true;
+        if (!cache) {
+            delete this->layer;
+            this->layer = nullptr;
+        }
+    }
+
+    bool Element::cacheAsLayer() {
+        return this->cacheAsLayer_;
+    }
+
+    void Element::draw() {
+        // Skip the element and it's children if they're hidden by clipping (e.g. scrolled out of view)
+        int border = this->hiSize;
+        if (this->renderer != nullptr && this->renderer->clipped(this->x_ - border, this->y_ - border, this->w_ + 2*border, this->h_ + 2*border)) {
+            return;
+        }
+
+        if (!this->cacheAsLayer_) {
+            this->render();
+            return;
+        }
+
+        // Do nothing if hidden or off-screen
+        if (!this->isVisible()) {
+            return;
+        }
+
+        // (Re)create the layer if the element's size changed, which covers the highlight border too
+        unsigned int layerW = this->w_ + 2*border;
+        unsigned int layerH = this->h_ + 2*border;
+        if (this->layer == nullptr || this->layer->width() != layerW || this->layer->height() != layerH) {
+            delete this->layer;
+            this->layer = this->renderer->createLayer(layerW, layerH);
+            this->layerDirty = true;
+        }
+
+        // Fall back to rendering normally if the layer couldn't be created
+        if (this->layer->type() != Drawable::Type::Texture) {
+            this->render();
+            return;
+        }
+
+        // Only redraw the layer if something in it has changed, otherwise what it shows
+        // is still in use and mustn't be evicted
+        bool dirty = (this->layerDirty || this->layerDrawnGeneration != this->layerGeneration);
+        if (dirty && this->renderer->beginLayer(this->layer, this->x_ - border, this->y_ - border)) {
+            this->render();
+            this->renderer->endLayer();
+            this->layerDirty = false;
+            this->layerDrawnGeneration = this->layerGeneration;
+        } else {
+            this->markDrawn(this->renderer->frameCount());
+        }
+        this->layer->render(this->x_ - border, this->y_ - border);
+    }
+
     bool Element::hidden() {
         return this->hidden_;
     }
 
     void Element::setHidden(bool b) {
+        if (b == this->hidden_) {
+            return;
+        }
+
+        // Damage is only reported while shown
+        this->invalidate();
         this->hidden_ = b;
+        this->invalidate();
     }
 
     bool Element::selected() {
@@ -202,6 +332,9 @@ namespace Aether {
     }
 
     void Element::setSelected(bool b) {
+        if (b != this->selected_) {
+            this->invalidate();
+        }
         this->selected_ = b;
         if (this->parent_ != nullptr) {
             this->parent_->setHasSelected(b);
@@ -230,6 +363,9 @@ namespace Aether {
     }
 
     void Element::setHighlighted(bool b) {
+        if (b != this->highlighted_) {
+            this->invalidate();
+        }
         this->highlighted_ = b;
         if (this->parent_ != nullptr) {
             this->parent_->setHasHighlighted(b);
@@ -347,6 +483,14 @@ namespace Aether {
         }
     }
 
+    void Element::markDrawn(const unsigned int frame) {
+        for (Element * child : this->children) {
+            if (!child->hidden()) {
+                child->markDrawn(frame);
+            }
+        }
+    }
+
     void Element::render() {
         // Do nothing if hidden or off-screen
         if (!this->isVisible()) {
@@ -363,7 +507,7 @@ namespace Aether {
 
         // Render children next
         for (size_t i = 0; i < this->children.size(); i++) {
-            this->children[i]->render();
+            this->children[i]->draw();
         }
 
         // Render selected/held layer
@@ -381,7 +525,7 @@ namespace Aether {
     }
 
     Drawable * Element::renderHighlightBG() {
-        return this->renderer->renderFilledRectTexture(this->w(), this->h());
+        return new Drawable(this->renderer, this->w(), this->h());
     }
 
     Drawable * Element::renderHighlight() {
@@ -389,7 +533,7 @@ namespace Aether {
     }
 
     Drawable * Element::renderSelection() {
-        return this->renderer->renderFilledRectTexture(this->w(), this->h());
+        return new Drawable(this->renderer, this->w(), this->h());
     }
 
     void Element::setActive() {
@@ -446,6 +590,7 @@ namespace Aether {
             }
         }
         this->removeAllElements();
+        delete this->layer;
 
         // Covers an edge case where an element could get the same address as the deleted element
         // and thus would cause the highlight to not be regenerated
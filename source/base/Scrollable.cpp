@@ -75,10 +75,6 @@ namespace Aether {
 
         // Subtract this element's height as it wasn't accounted for earlier
         this->maxScrollPos_ -= this->h();
-
-        // Delete scroll bar due to new height
-        delete this->scrollBar;
-        this->scrollBar = nullptr;
     }
 
     void Scrollable::stopScrolling() {
@@ -174,6 +170,7 @@ namespace Aether {
 
         // Update children positions
         if (old != this->scrollPos_) {
+            this->invalidate();
             for (size_t i = 0; i < this->children.size(); i++) {
                 this->children[i]->setY(this->children[i]->y() - (this->scrollPos_ - old));
             }
@@ -512,6 +509,7 @@ namespace Aether {
 
         // If scrolling due to touch event
         if (this->isScrolling) {
+            this->requestFrame();
             this->setScrollPos(this->scrollPos_ + this->scrollVelocity);
             if (this->scrollPos_ == 0 || this->scrollPos_ == this->maxScrollPos_) {
                 this->scrollVelocity = 0;
@@ -528,13 +526,10 @@ namespace Aether {
             }
         }
 
-        // Recreate scroll bar texture if needed
+        // Create scroll bar texture if needed (it's stretched to the required height when drawn)
         if (this->scrollBar == nullptr) {
-            int size = (0.8*this->h()) * (this->h()/(double)(this->h() + this->maxScrollPos_/3));
-            if (size < MIN_SCROLLBAR_SIZE) {
-                size = MIN_SCROLLBAR_SIZE;
-            }
-            this->scrollBar = this->renderer->renderFilledRoundRectTexture(SCROLLBAR_WIDTH, size, SCROLLBAR_WIDTH/2);
+            this->scrollBar = this->renderer->renderFilledRoundRectTexture(SCROLLBAR_WIDTH, SCROLLBAR_WIDTH, SCROLLBAR_WIDTH/2);
+            this->scrollBar->setNineSlice(SCROLLBAR_WIDTH/2);
         }
     }
 
@@ -550,6 +545,12 @@ namespace Aether {
 
         // Draw scroll bar
         if (this->maxScrollPos_ != 0 && this->showScrollBar_ && this->scrollBar != nullptr) {
+            int size = (0.8*this->h()) * (this->h()/(double)(this->h() + this->maxScrollPos_/3));
+            if (size < MIN_SCROLLBAR_SIZE) {
+                size = MIN_SCROLLBAR_SIZE;
+            }
+            this->scrollBar->setSize(SCROLLBAR_WIDTH, size);
+
             int yPos = this->y() + PADDING/2 + (((float)this->scrollPos_ / this->maxScrollPos_) * (this->h() - this->scrollBar->height() - PADDING));
             this->scrollBar->setColour(this->scrollBarColour);
             this->scrollBar->render(this->x() + this->w() - this->scrollBar->width(), yPos);
@@ -1,13 +1,34 @@
 #include "Aether/base/Texture.hpp"
 #include "Aether/base/Texture.RenderJob.hpp"
+#include "Aether/Renderer.hpp"
 
 namespace Aether {
-    Texture::RenderJob::RenderJob(Texture * texture) : Job() {
-        this->texture = texture;
+    Texture::RenderJob::RenderJob(const std::function<Drawable * ()> & func, const std::shared_ptr<AsyncState> & state, Renderer * renderer) : Job() {
+        this->func = func;
+        this->state = state;
+        this->renderer = renderer;
     }
 
     void Texture::RenderJob::work() {
-        this->texture->tmpDrawable = this->texture->renderDrawable();
-        this->texture->status = AsyncStatus::NeedsConvert;
+        Drawable * drawable = this->func();
+
+        // Hand the result over, unless the texture was destroyed while rendering
+        bool abandoned;
+        {
+            std::scoped_lock<std::mutex> mtx(this->state->mtx);
+            abandoned = this->state->abandoned;
+            if (!abandoned) {
+                this->state->result = drawable;
+            }
+        }
+
+        // The result may hold a texture (e.g. a cached shape), so it's deleted on the main thread
+        if (abandoned) {
+            this->renderer->discardDrawable(drawable);
+            return;
+        }
+
+        // Wake the main loop in case it's idle, so the result is converted
+        this->renderer->wakeUp();
     }
 }
\ No newline at end of file
@@ -1,24 +1,59 @@
 #include "Aether/base/Texture.hpp"
 #include "Aether/base/Texture.RenderJob.hpp"
 #include "Aether/ThreadPool.hpp"
+#include <algorithm>
 
 namespace Aether {
+    std::unordered_set<Texture *> Texture::instances;
+
     Texture::Texture(const int x, const int y) : Element(x, y, 0, 0) {
         this->asyncID = 0;
+        this->asyncState = nullptr;
+        this->asyncCallsElement = false;
         this->onRenderDoneFunc = nullptr;
         this->status = AsyncStatus::Waiting;
 
         this->colour_ = Colour(255, 255, 255, 255);
+        this->format_ = TextureFormat::Auto;
         this->drawable = new Drawable();
         this->tmpDrawable = nullptr;
+
+        this->lastDrawn = 0;
+        this->renderedAsync = false;
+        this->evicted = false;
+        this->restoring = false;
+        this->hasMask = false;
+        this->hasTextureSize = false;
+        Texture::instances.insert(this);
     }
 
     void Texture::setupDrawable() {
+        this->drawable->setFormat(this->format_);
         this->drawable->convertToTexture();
         this->drawable->setColour(this->colour_);
 
+        // A texture rendered again after eviction is laid out exactly as before
+        if (this->restoring) {
+            this->restoring = false;
+            if (this->hasTextureSize) {
+                this->drawable->setSize(this->textureW, this->textureH);
+            }
+            if (this->hasMask) {
+                this->drawable->setMask(this->maskX, this->maskY, this->maskW, this->maskH);
+            }
+            this->invalidate();
+            return;
+        }
+
+        // A size set while the texture was being rendered applies to the result (keeping the element's size)
+        if (this->hasTextureSize) {
+            this->drawable->setSize(this->textureW, this->textureH);
+        }
+        this->hasMask = false;
+
         this->setW(this->drawable->width());
         this->setH(this->drawable->height());
+        this->invalidate();
 
         if (this->onRenderDoneFunc != nullptr) {
             this->onRenderDoneFunc();
@@ -34,8 +69,17 @@ namespace Aether {
     }
 
     void Texture::setColour(const Colour & col) {
+        // Only report a change if there is one, as some elements set their colour every frame
+        bool changed = (col.r() != this->colour_.r() || col.g() != this->colour_.g() || col.b() != this->colour_.b() || col.a() != this->colour_.a());
         this->colour_ = col;
         this->drawable->setColour(this->colour_);
+        if (changed) {
+            this->invalidate();
+        }
+    }
+
+    void Texture::setTextureFormat(const TextureFormat format) {
+        this->format_ = format;
     }
 
     int Texture::textureWidth() {
@@ -47,22 +91,97 @@ namespace Aether {
     }
 
     void Texture::setMask(const int x, const int y, const unsigned int w, const unsigned int h) {
+        this->hasMask = true;
+        this->maskX = x;
+        this->maskY = y;
+        this->maskW = w;
+        this->maskH = h;
         this->drawable->setMask(x, y, w, h);
+        this->invalidate();
     }
 
-    void Texture::destroy() {
-        if (this->status == AsyncStatus::Rendering) {
-            ThreadPool::getInstance()->removeOrWaitForJob(this->asyncID);
-            this->asyncID = 0;
+    void Texture::setTextureSize(const unsigned int w, const unsigned int h) {
+        this->hasMask = false;
+        this->hasTextureSize = true;
+        this->textureW = w;
+        this->textureH = h;
+        this->drawable->setSize(w, h);
+        this->invalidate();
+    }
+
+    void Texture::abandonAsync() {
+        if (this->asyncState == nullptr) {
+            return;
         }
 
+        // Don't wait for a task that's already running, instead it's result is dropped once finished,
+        // unless it calls back into this element
+        if (!ThreadPool::getInstance()->removeJob(this->asyncID)) {
+            if (this->asyncCallsElement) {
+                ThreadPool::getInstance()->removeOrWaitForJob(this->asyncID);
+            }
+
+            std::scoped_lock<std::mutex> mtx(this->asyncState->mtx);
+            this->asyncState->abandoned = true;
+            delete this->asyncState->result;
+            this->asyncState->result = nullptr;
+        }
+        this->asyncState = nullptr;
+        this->asyncID = 0;
+    }
+
+    void Texture::destroy() {
+        this->abandonAsync();
+        this->evicted = false;
+        this->restoring = false;
+        this->hasTextureSize = false;
+        delete this->tmpDrawable;
+        this->tmpDrawable = nullptr;
+        this->status = AsyncStatus::Waiting;
+
+        this->invalidate();
+        delete this->drawable;
+        this->drawable = new Drawable();
+    }
+
+    void Texture::evict() {
         delete this->drawable;
         this->drawable = new Drawable();
         this->status = AsyncStatus::Waiting;
+        this->evicted = true;
+    }
+
+    void Texture::enforceTextureBudget() {
+        size_t excess = Element::renderer->textureBudgetExcess();
+        if (excess == 0) {
+            return;
+        }
+
+        // Only consider textures which weren't drawn in the last frame, so nothing visible is evicted
+        unsigned int frame = Element::renderer->frameCount();
+        std::vector<Texture *> candidates;
+        for (Texture * tex : Texture::instances) {
+            if (tex->status == AsyncStatus::Done && tex->lastDrawn + 1 < frame && tex->drawable->textureSize() > 0) {
+                candidates.push_back(tex);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const Texture * a, const Texture * b) {
+            return a->lastDrawn < b->lastDrawn;
+        });
+
+        size_t freed = 0;
+        for (Texture * tex : candidates) {
+            if (freed >= excess) {
+                break;
+            }
+
+            freed += tex->drawable->textureSize();
+            tex->evict();
+        }
     }
 
     bool Texture::ready() {
-        return (this->drawable->type() == Drawable::Type::Texture);
+        return (this->drawable->type() == Drawable::Type::Texture || this->drawable->type() == Drawable::Type::Fill);
     }
 
     void Texture::renderSync() {
@@ -74,6 +193,8 @@ namespace Aether {
         this->drawable = this->renderDrawable();
         this->setupDrawable();
         this->status = AsyncStatus::Done;
+        this->renderedAsync = false;
+        this->evicted = false;
     }
 
     void Texture::renderAsync() {
@@ -82,11 +203,44 @@ namespace Aether {
         }
 
         this->status = AsyncStatus::Rendering;
-        this->asyncID = ThreadPool::getInstance()->queueJob(new RenderJob(this), ThreadPool::Importance::Normal);
+        this->renderedAsync = true;
+        this->evicted = false;
+        this->asyncState = std::make_shared<AsyncState>();
+        this->asyncState->abandoned = false;
+        this->asyncState->result = nullptr;
+        this->asyncCallsElement = false;
+        std::function<Drawable * ()> func = this->renderFunction();
+        this->asyncID = ThreadPool::getInstance()->queueJob(new RenderJob(func, this->asyncState, this->renderer), ThreadPool::Importance::Normal);
+    }
+
+    std::function<Drawable * ()> Texture::renderFunction() {
+        this->asyncCallsElement = true;
+        return [this]() {
+            return this->renderDrawable();
+        };
     }
 
     void Texture::update(unsigned int dt) {
-        if (this->status == AsyncStatus::NeedsConvert) {
+        // Take the result once the task has finished
+        if (this->status == AsyncStatus::Rendering) {
+            {
+                std::scoped_lock<std::mutex> mtx(this->asyncState->mtx);
+                this->tmpDrawable = this->asyncState->result;
+                this->asyncState->result = nullptr;
+            }
+
+            if (this->tmpDrawable != nullptr) {
+                this->asyncState = nullptr;
+                this->asyncID = 0;
+                this->status = AsyncStatus::NeedsConvert;
+            }
+        }
+
+        // Wait for a later frame if too much has already been uploaded in this one
+        if (this->status == AsyncStatus::NeedsConvert && !this->renderer->reserveUpload(this->tmpDrawable->surfaceSize())) {
+            this->requestFrame();
+
+        } else if (this->status == AsyncStatus::NeedsConvert) {
             delete this->drawable;
             this->drawable = this->tmpDrawable;
             this->tmpDrawable = nullptr;
@@ -97,19 +251,36 @@ namespace Aether {
         Element::update(dt);
     }
 
+    void Texture::markDrawn(const unsigned int frame) {
+        this->lastDrawn = frame;
+        Element::markDrawn(frame);
+    }
+
     void Texture::render() {
         if (this->hidden()) {
             return;
         }
 
+        // Render again if the texture was evicted to free memory
+        if (this->evicted) {
+            this->restoring = true;
+            if (this->renderedAsync) {
+                this->renderAsync();
+            } else {
+                this->renderSync();
+            }
+        }
+        this->lastDrawn = this->renderer->frameCount();
+
         this->drawable->render(this->x(), this->y(), this->w(), this->h());
         Element::render();
     }
 
     Texture::~Texture() {
-        if (this->status == AsyncStatus::Rendering) {
-            ThreadPool::getInstance()->removeOrWaitForJob(this->asyncID);
-        }
+        Texture::instances.erase(this);
+
+        // A task still running is left to discard it's result, unless it reads this element
+        this->abandonAsync();
         delete this->drawable;
         delete this->tmpDrawable;
     }
@@ -166,6 +166,7 @@ namespace Aether {
 
         // Otherwise handle repeated input
         } else {
+            this->requestFrame();
             this->holdTime += dt;
             // Still within HOLD_DELAY
             if (this->held == SpinnerHoldAction::UpHeld || this->held == SpinnerHoldAction::DownHeld) {
@@ -14,6 +14,11 @@ namespace Aether {
 
         // Increment time and change frame if need be
         if (!this->paused) {
+            if (this->children.size() > 1) {
+                this->requestFrame();
+            }
+
+            unsigned int old = this->idx;
             this->currTime += dt;
             while (this->currTime >= this->frameTime) {
                 this->currTime -= this->frameTime;
@@ -22,6 +27,10 @@ namespace Aether {
                     this->idx = 0;
                 }
             }
+
+            if (this->idx != old) {
+                this->invalidate();
+            }
         }
     }
 
@@ -40,7 +49,7 @@ namespace Aether {
 
         // Render active child
         if (this->idx < this->children.size()) {
-            this->children[this->idx]->render();
+            this->children[this->idx]->draw();
         }
 
         // Render selected/held layer
@@ -80,6 +89,9 @@ namespace Aether {
     bool Animation::setFrameIndex(unsigned int i) {
         if (i < this->children.size()) {
             this->currTime = 0;
+            if (this->idx != i) {
+                this->invalidate();
+            }
             this->idx = i;
             return true;
         }
@@ -1,19 +1,46 @@
 #include "Aether/primary/Box.hpp"
 
 namespace Aether {
-    Box::Box(const int x, const int y, const int w, const int h, const unsigned int thick, const unsigned int radius) : Texture(x, y) {
+    Box::Box(const int x, const int y, const int w, const int h, const unsigned int thick, const unsigned int radius, const Render type) : Texture(x, y) {
         Texture::setW(w);
         Texture::setH(h);
+        this->border_ = thick;
         this->cornerRadius_ = radius;
-        this->setThickness(thick);
+
+        // Render based on requested type
+        if (type == Render::Sync) {
+            this->renderSync();
+
+        } else if (type == Render::Async) {
+            this->renderAsync();
+        }
     }
 
     Drawable * Box::renderDrawable() {
-        if (this->cornerRadius_ > 0) {
-            return this->renderer->renderRoundRectTexture(this->w(), this->h(), this->cornerRadius_, this->border_);
-        } else {
-            return this->renderer->renderRectTexture(this->w(), this->h(), this->border_);
-        }
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> Box::renderFunction() {
+        Renderer * renderer = this->renderer;
+        unsigned int radius = this->cornerRadius_;
+        unsigned int border = this->border_;
+        int w = this->w();
+        int h = this->h();
+        return [renderer, radius, border, w, h]() {
+            // Only the corners (plus a pixel between them) are rendered, which is then stretched
+            Drawable * drawable;
+            unsigned int inset = (radius > border ? radius : border);
+            unsigned int size = 2*inset + 1;
+            if (radius > 0) {
+                drawable = renderer->renderRoundRectSurface(size, size, radius, border);
+            } else {
+                drawable = renderer->renderRectSurface(size, size, border);
+            }
+
+            drawable->setNineSlice(inset);
+            drawable->setSize(w, h);
+            return drawable;
+        };
     }
 
     unsigned int Box::thickness() {
@@ -29,8 +56,7 @@ namespace Aether {
     void Box::setBoxSize(const int w, const int h) {
         Texture::setW(w);
         Texture::setH(h);
-        this->destroy();
-        this->renderSync();
+        this->setTextureSize(w, h);
     }
 
     unsigned int Box::cornerRadius() {
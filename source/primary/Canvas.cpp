@@ -0,0 +1,179 @@
+#include "Aether/primary/Canvas.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// Maximum number of separate dirty areas before they're combined into one
+static constexpr size_t maxDirtyRects = 4;
+
+namespace Aether {
+    Canvas::Canvas(const int x, const int y, const unsigned int w, const unsigned int h) : Element(x, y, w, h) {
+        this->canvasWidth_ = w;
+        this->canvasHeight_ = h;
+        this->buffer.assign(w * h, toPixel(Colour(255, 255, 255, 0)));
+        this->drawable = nullptr;
+        this->markDirty(0, 0, w, h);
+    }
+
+    uint32_t Canvas::toPixel(const Colour & col) {
+        // Form the pixel from bytes so it's independent of endianness
+        const uint8_t bytes[4] = {col.r(), col.g(), col.b(), col.a()};
+        uint32_t pixel;
+        std::memcpy(&pixel, bytes, sizeof(pixel));
+        return pixel;
+    }
+
+    unsigned int Canvas::canvasWidth() {
+        return this->canvasWidth_;
+    }
+
+    unsigned int Canvas::canvasHeight() {
+        return this->canvasHeight_;
+    }
+
+    void Canvas::clear(const Colour & col) {
+        std::fill(this->buffer.begin(), this->buffer.end(), toPixel(col));
+        this->markDirty(0, 0, this->canvasWidth_, this->canvasHeight_);
+    }
+
+    void Canvas::setPixel(const int x, const int y, const Colour & col) {
+        if (x < 0 || y < 0 || x >= static_cast<int>(this->canvasWidth_) || y >= static_cast<int>(this->canvasHeight_)) {
+            return;
+        }
+
+        this->buffer[y * this->canvasWidth_ + x] = toPixel(col);
+        this->markDirty(x, y, 1, 1);
+    }
+
+    void Canvas::fillRect(const int x, const int y, const int w, const int h, const Colour & col) {
+        // Clip to the canvas
+        int x1 = std::max(x, 0);
+        int y1 = std::max(y, 0);
+        int x2 = std::min(x + w, static_cast<int>(this->canvasWidth_));
+        int y2 = std::min(y + h, static_cast<int>(this->canvasHeight_));
+        if (x1 >= x2 || y1 >= y2) {
+            return;
+        }
+
+        uint32_t pixel = toPixel(col);
+        for (int row = y1; row < y2; row++) {
+            std::fill_n(this->buffer.begin() + row * this->canvasWidth_ + x1, x2 - x1, pixel);
+        }
+        this->markDirty(x1, y1, x2 - x1, y2 - y1);
+    }
+
+    void Canvas::drawLine(const int x1, const int y1, const int x2, const int y2, const Colour & col) {
+        // Step along the line using Bresenham's algorithm
+        uint32_t pixel = toPixel(col);
+        int dx = std::abs(x2 - x1);
+        int dy = -std::abs(y2 - y1);
+        int sx = (x1 < x2 ? 1 : -1);
+        int sy = (y1 < y2 ? 1 : -1);
+        int err = dx + dy;
+        int x = x1;
+        int y = y1;
+        while (true) {
+            if (x >= 0 && y >= 0 && x < static_cast<int>(this->canvasWidth_) && y < static_cast<int>(this->canvasHeight_)) {
+                this->buffer[y * this->canvasWidth_ + x] = pixel;
+            }
+            if (x == x2 && y == y2) {
+                break;
+            }
+
+            int e2 = 2*err;
+            if (e2 >= dy) {
+                err += dy;
+                x += sx;
+            }
+            if (e2 <= dx) {
+                err += dx;
+                y += sy;
+            }
+        }
+
+        this->markDirty(std::min(x1, x2), std::min(y1, y2), dx + 1, -dy + 1);
+    }
+
+    uint8_t * Canvas::pixels() {
+        return reinterpret_cast<uint8_t *>(this->buffer.data());
+    }
+
+    size_t Canvas::pitch() {
+        return this->canvasWidth_ * sizeof(uint32_t);
+    }
+
+    void Canvas::markDirty(const int x, const int y, const int w, const int h) {
+        // Clip to the canvas
+        int x1 = std::max(x, 0);
+        int y1 = std::max(y, 0);
+        int x2 = std::min(x + w, static_cast<int>(this->canvasWidth_));
+        int y2 = std::min(y + h, static_cast<int>(this->canvasHeight_));
+        if (x1 >= x2 || y1 >= y2) {
+            return;
+        }
+
+        // Grow an existing area if they touch, otherwise track it separately
+        DirtyRect rect = {x1, y1, x2 - x1, y2 - y1};
+        bool merged = false;
+        for (DirtyRect & other : this->dirty) {
+            if (rect.x <= other.x + other.w && other.x <= rect.x + rect.w && rect.y <= other.y + other.h && other.y <= rect.y + rect.h) {
+                int ox2 = std::max(other.x + other.w, x2);
+                int oy2 = std::max(other.y + other.h, y2);
+                other.x = std::min(other.x, x1);
+                other.y = std::min(other.y, y1);
+                other.w = ox2 - other.x;
+                other.h = oy2 - other.y;
+                merged = true;
+                break;
+            }
+        }
+        if (!merged) {
+            this->dirty.push_back(rect);
+        }
+
+        // Too many separate uploads cost more than one larger one
+        if (this->dirty.size() > maxDirtyRects) {
+            DirtyRect bounds = this->dirty[0];
+            for (const DirtyRect & other : this->dirty) {
+                int bx2 = std::max(bounds.x + bounds.w, other.x + other.w);
+                int by2 = std::max(bounds.y + bounds.h, other.y + other.h);
+                bounds.x = std::min(bounds.x, other.x);
+                bounds.y = std::min(bounds.y, other.y);
+                bounds.w = bx2 - bounds.x;
+                bounds.h = by2 - bounds.y;
+            }
+            this->dirty.clear();
+            this->dirty.push_back(bounds);
+        }
+
+        this->invalidate();
+    }
+
+    void Canvas::render() {
+        if (this->hidden()) {
+            return;
+        }
+
+        // Create the texture on first use, uploading everything
+        if (this->drawable == nullptr) {
+            this->drawable = this->renderer->createStreamingTexture(this->canvasWidth_, this->canvasHeight_);
+            this->dirty.clear();
+            this->dirty.push_back(DirtyRect{0, 0, static_cast<int>(this->canvasWidth_), static_cast<int>(this->canvasHeight_)});
+        }
+
+        // Upload only what's changed since last frame
+        if (this->drawable->type() == Drawable::Type::Texture) {
+            for (const DirtyRect & rect : this->dirty) {
+                this->renderer->updateStreamingTexture(this->drawable, this->pixels(), this->pitch(), rect.x, rect.y, rect.w, rect.h);
+            }
+            this->dirty.clear();
+        }
+
+        this->drawable->render(this->x(), this->y(), this->w(), this->h());
+        Element::render();
+    }
+
+    Canvas::~Canvas() {
+        delete this->drawable;
+    }
+};
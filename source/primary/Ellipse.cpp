@@ -1,14 +1,30 @@
 #include "Aether/primary/Ellipse.hpp"
 
 namespace Aether {
-    Ellipse::Ellipse(const int x, const int y, const unsigned int xd, const unsigned int yd) : Texture(x, y) {
+    Ellipse::Ellipse(const int x, const int y, const unsigned int xd, const unsigned int yd, const Render type) : Texture(x, y) {
         this->xDiameter_ = xd;
         this->yDiameter_ = ((yd == 0) ? xd : yd);
-        this->renderSync();
+
+        // Render based on requested type
+        if (type == Render::Sync) {
+            this->renderSync();
+
+        } else if (type == Render::Async) {
+            this->renderAsync();
+        }
     }
 
     Drawable * Ellipse::renderDrawable() {
-        return this->renderer->renderFilledEllipseTexture(this->xDiameter_/2, this->yDiameter_/2);
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> Ellipse::renderFunction() {
+        Renderer * renderer = this->renderer;
+        unsigned int rx = this->xDiameter_/2;
+        unsigned int ry = this->yDiameter_/2;
+        return [renderer, rx, ry]() {
+            return renderer->renderFilledEllipseSurface(rx, ry);
+        };
     }
 
     unsigned int Ellipse::xDiameter() {
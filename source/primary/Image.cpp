@@ -21,25 +21,41 @@ namespace Aether {
     Image::Image(const int x, const int y, const std::vector<unsigned char> & data, const Render type) : Texture(x, y) {
         this->scaleWidth_ = 0;
         this->scaleHeight_ = 0;
-        this->copy = data;
+        this->copy = std::make_shared<const std::vector<unsigned char>>(data);
         this->type = Type::Vector;
         this->performRender(type);
     }
 
     Drawable * Image::renderDrawable() {
-        switch (this->type) {
-            case Type::File:
-                return this->renderer->renderImageSurface(this->path, this->scaleWidth_, this->scaleHeight_);
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> Image::renderFunction() {
+        // Take a copy of the caller's buffer, as it may be freed along with this element (our own copy is shared instead)
+        Renderer * renderer = this->renderer;
+        Type type = this->type;
+        std::string path = this->path;
+        std::shared_ptr<const std::vector<unsigned char>> buf = this->copy;
+        if (type == Type::Pointer) {
+            buf = std::make_shared<const std::vector<unsigned char>>(this->mem.ptr, this->mem.ptr + this->mem.size);
+        }
+        size_t scaleWidth = this->scaleWidth_;
+        size_t scaleHeight = this->scaleHeight_;
 
-            case Type::Pointer: {
-                std::vector<unsigned char> buf;
-                buf.assign(this->mem.ptr, this->mem.ptr + this->mem.size);
-                return this->renderer->renderImageSurface(buf, this->scaleWidth_, this->scaleHeight_);
+        return [renderer, type, path, buf, scaleWidth, scaleHeight]() {
+            Drawable * drawable = nullptr;
+            if (type == Type::File) {
+                drawable = renderer->renderImageSurface(path, scaleWidth, scaleHeight);
+            } else {
+                drawable = renderer->renderImageSurface(*buf, scaleWidth, scaleHeight);
             }
 
-            case Type::Vector:
-                return this->renderer->renderImageSurface(this->copy, this->scaleWidth_, this->scaleHeight_);
-        }
+            // Icons and other small images share textures
+            if (drawable != nullptr) {
+                drawable->setAtlas(true);
+            }
+            return drawable;
+        };
     }
 
     void Image::performRender(const Render type) {
@@ -52,8 +68,10 @@ namespace Aether {
     }
 
     bool Image::setScaleDimensions(const size_t width, const size_t height) {
-        // We can't render images over 8000px
-        if (width >= 8000 || height >= 8000) {
+        // We can't render images larger than the backend's largest texture
+        unsigned int maxW = (this->renderer != nullptr ? this->renderer->maxTextureWidth() : 0);
+        unsigned int maxH = (this->renderer != nullptr ? this->renderer->maxTextureHeight() : 0);
+        if ((maxW != 0 && width > maxW) || (maxH != 0 && height > maxH)) {
             return false;
         }
 
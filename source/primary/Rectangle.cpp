@@ -1,18 +1,42 @@
 #include "Aether/primary/Rectangle.hpp"
 
 namespace Aether {
-    Rectangle::Rectangle(int x, int y, int w, int h, unsigned int r) : Texture(x, y) {
+    Rectangle::Rectangle(int x, int y, int w, int h, unsigned int r, const Render type) : Texture(x, y) {
         Texture::setW(w);
         Texture::setH(h);
-        this->setCornerRadius(r);
+        this->cornerRadius_ = r;
+
+        // Render based on requested type
+        if (type == Render::Sync) {
+            this->renderSync();
+
+        } else if (type == Render::Async) {
+            this->renderAsync();
+        }
     }
 
     Drawable * Rectangle::renderDrawable() {
-        if (this->cornerRadius_ > 0) {
-            return this->renderer->renderFilledRoundRectTexture(this->w(), this->h(), this->cornerRadius_);
-        } else {
-            return this->renderer->renderFilledRectTexture(this->w(), this->h());
-        }
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> Rectangle::renderFunction() {
+        Renderer * renderer = this->renderer;
+        unsigned int radius = this->cornerRadius_;
+        int w = this->w();
+        int h = this->h();
+        return [renderer, radius, w, h]() {
+            // Square rectangles don't need a texture at all
+            if (radius == 0) {
+                return new Drawable(renderer, w, h);
+            }
+
+            // Otherwise only the corners (plus a pixel between them) are rendered, which is then stretched
+            unsigned int size = 2*radius + 1;
+            Drawable * drawable = renderer->renderFilledRoundRectSurface(size, size, radius);
+            drawable->setNineSlice(radius);
+            drawable->setSize(w, h);
+            return drawable;
+        };
     }
 
     unsigned int Rectangle::cornerRadius() {
@@ -28,7 +52,6 @@ namespace Aether {
     void Rectangle::setRectSize(int w, int h) {
         Texture::setW(w);
         Texture::setH(h);
-        this->destroy();
-        this->renderSync();
+        this->setTextureSize(w, h);
     }
 };
\ No newline at end of file
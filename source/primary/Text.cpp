@@ -30,11 +30,20 @@ namespace Aether {
     }
 
     Drawable * Text::renderDrawable() {
-        if (this->string_.empty()) {
-            return new Drawable();
-        } else {
-            return this->renderer->renderTextSurface(this->string_, this->fontSize_);
-        }
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> Text::renderFunction() {
+        Renderer * renderer = this->renderer;
+        std::string string = this->string_;
+        unsigned int fontSize = this->fontSize_;
+        return [renderer, string, fontSize]() {
+            if (string.empty()) {
+                return new Drawable();
+            } else {
+                return renderer->renderTextSurface(string, fontSize);
+            }
+        };
     }
 
     bool Text::canScroll() {
@@ -71,6 +80,8 @@ namespace Aether {
 
         // Check if we need to scroll and do so
         if (this->scroll.allowed && this->textureWidth() > this->w()) {
+            this->requestFrame();
+
             // If we're past the end
             if (this->scroll.position >= (this->textureWidth() - this->w())) {
                 // Go back to the start once we've paused
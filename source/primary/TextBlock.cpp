@@ -19,7 +19,17 @@ namespace Aether {
     }
 
     Drawable * TextBlock::renderDrawable() {
-        return this->renderer->renderWrappedTextSurface(this->string_, this->fontSize_, this->wrapWidth_);
+        return this->renderFunction()();
+    }
+
+    std::function<Drawable * ()> TextBlock::renderFunction() {
+        Renderer * renderer = this->renderer;
+        std::string string = this->string_;
+        unsigned int fontSize = this->fontSize_;
+        unsigned int wrapWidth = this->wrapWidth_;
+        return [renderer, string, fontSize, wrapWidth]() {
+            return renderer->renderWrappedTextSurface(string, fontSize, wrapWidth);
+        };
     }
 
     unsigned int TextBlock::wrapWidth() {
@@ -1,50 +1,114 @@
 #include "Aether/types/Drawable.hpp"
 #include "Aether/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <SDL2/SDL.h>
 
 namespace Aether {
     Drawable::Drawable() {
         this->data.surface = nullptr;
         this->colour_ = Colour(255, 255, 255, 255);
+        this->format_ = TextureFormat::Auto;
         this->type_ = Type::None;
         this->width_ = 0;
         this->height_ = 0;
         this->renderer = nullptr;
         this->setMask(0, 0, 0, 0);
+        this->nineSlice_ = false;
+        this->sliceInset = 0;
+        this->srcWidth = 0;
+        this->srcHeight = 0;
+        this->atlas_ = false;
+        this->packed = false;
+        this->originX = 0;
+        this->originY = 0;
     }
 
     Drawable::Drawable(Renderer * renderer, SDL_Surface * surf, const unsigned int width, const unsigned int height) {
         this->data.surface = surf;
         this->colour_ = Colour(255, 255, 255, 255);
+        this->format_ = TextureFormat::Auto;
         this->type_ = Type::Surface;
         this->width_ = width;
         this->height_ = height;
         this->renderer = renderer;
         this->setMask(0, 0, width, height);
+        this->nineSlice_ = false;
+        this->sliceInset = 0;
+        this->srcWidth = width;
+        this->srcHeight = height;
+        this->atlas_ = false;
+        this->packed = false;
+        this->originX = 0;
+        this->originY = 0;
     }
 
     Drawable::Drawable(Renderer * renderer, SDL_Texture * tex, const unsigned int width, const unsigned int height) {
         this->data.texture = tex;
         this->colour_ = Colour(255, 255, 255, 255);
+        this->format_ = TextureFormat::Auto;
         this->type_ = Type::Texture;
         this->width_ = width;
         this->height_ = height;
         this->renderer = renderer;
         this->setMask(0, 0, width, height);
+        this->nineSlice_ = false;
+        this->sliceInset = 0;
+        this->srcWidth = width;
+        this->srcHeight = height;
+        this->atlas_ = false;
+        this->packed = false;
+        this->originX = 0;
+        this->originY = 0;
+    }
+
+    Drawable::Drawable(Renderer * renderer, const unsigned int width, const unsigned int height) {
+        this->data.texture = nullptr;
+        this->colour_ = Colour(255, 255, 255, 255);
+        this->format_ = TextureFormat::Auto;
+        this->type_ = Type::Fill;
+        this->width_ = width;
+        this->height_ = height;
+        this->renderer = renderer;
+        this->setMask(0, 0, width, height);
+        this->nineSlice_ = false;
+        this->sliceInset = 0;
+        this->srcWidth = width;
+        this->srcHeight = height;
+        this->atlas_ = false;
+        this->packed = false;
+        this->originX = 0;
+        this->originY = 0;
     }
 
     ImageData Drawable::getImageData() {
-        // Read pixels from stored data
-        std::vector<Colour> pixels;
+        // Read pixels from stored data (always RGBA)
+        std::vector<uint8_t> pixels;
         if (this->type_ == Type::Surface) {
-            pixels = this->renderer->readSurfacePixels(this->data.surface);
+            pixels = this->renderer->readSurfaceBytes(this->data.surface);
 
         } else if (this->type_ == Type::Texture) {
-            pixels = this->renderer->readTexturePixels(this->data.texture);
+            pixels = this->renderer->readTextureBytes(this->data.texture);
+
+            // Only keep this image's area of a shared texture
+            if (this->packed && !pixels.empty()) {
+                int pageW;
+                SDL_QueryTexture(this->data.texture, nullptr, nullptr, &pageW, nullptr);
+                std::vector<uint8_t> area(this->srcWidth * this->srcHeight * 4);
+                for (size_t row = 0; row < this->srcHeight; row++) {
+                    const uint8_t * src = pixels.data() + ((this->originY + row) * pageW + this->originX) * 4;
+                    std::copy(src, src + this->srcWidth * 4, area.begin() + row * this->srcWidth * 4);
+                }
+                pixels.swap(area);
+            }
+
+        } else if (this->type_ == Type::Fill) {
+            return ImageData(std::vector<Colour>(this->width_ * this->height_, Colour(255, 255, 255, 255)), this->width_, this->height_, 4);
         }
 
-        // Convert to ImageData if successful (always RGBA)
+        // Convert to ImageData if successful, which is the size of the stored data
         if (pixels.size() > 0) {
-            return ImageData(pixels, this->width_, this->height_, 4);
+            return ImageData(pixels, this->srcWidth, this->srcHeight, 4);
         }
 
         // Return invalid data if nothing stored
@@ -62,13 +126,106 @@ namespace Aether {
         this->maskH = height;
     }
 
+    void Drawable::setNineSlice(const unsigned int inset) {
+        this->nineSlice_ = true;
+        this->sliceInset = inset;
+        this->srcWidth = this->width_;
+        this->srcHeight = this->height_;
+        this->setMask(0, 0, this->width_, this->height_);
+    }
+
+    bool Drawable::nineSlice() {
+        return this->nineSlice_;
+    }
+
+    void Drawable::setSize(const unsigned int width, const unsigned int height) {
+        if (!this->nineSlice_ && this->type_ != Type::Fill) {
+            return;
+        }
+
+        this->width_ = width;
+        this->height_ = height;
+        this->setMask(0, 0, width, height);
+    }
+
+    void Drawable::renderNineSlice(const int x, const int y, const unsigned int width, const unsigned int height) {
+        if (this->maskW <= 0 || this->maskH <= 0) {
+            return;
+        }
+
+        // Crop the corners if they don't fit within the laid out size (shrinking the
+        // source corners too, so they aren't squashed)
+        int cornerW = std::min<int>(this->sliceInset, this->width_/2);
+        int cornerH = std::min<int>(this->sliceInset, this->height_/2);
+
+        // Boundaries between slices in the laid out image and the stored texture
+        const int layX[4] = {0, cornerW, static_cast<int>(this->width_) - cornerW, static_cast<int>(this->width_)};
+        const int layY[4] = {0, cornerH, static_cast<int>(this->height_) - cornerH, static_cast<int>(this->height_)};
+        const int srcX[4] = {0, cornerW, static_cast<int>(this->srcWidth) - cornerW, static_cast<int>(this->srcWidth)};
+        const int srcY[4] = {0, cornerH, static_cast<int>(this->srcHeight) - cornerH, static_cast<int>(this->srcHeight)};
+
+        // The masked area is stretched over the given size
+        float scaleX = width/static_cast<float>(this->maskW);
+        float scaleY = height/static_cast<float>(this->maskH);
+
+        for (size_t row = 0; row < 3; row++) {
+            // Clip the slice to the mask
+            int y1 = std::max(layY[row], this->maskY);
+            int y2 = std::min(layY[row + 1], this->maskY + this->maskH);
+            if (y2 <= y1) {
+                continue;
+            }
+
+            // Find matching area of stored texture and screen
+            float sliceH = (srcY[row + 1] - srcY[row])/static_cast<float>(layY[row + 1] - layY[row]);
+            float v1 = this->originY + srcY[row] + (y1 - layY[row]) * sliceH;
+            float v2 = this->originY + srcY[row] + (y2 - layY[row]) * sliceH;
+            int dy1 = y + std::lround((y1 - this->maskY) * scaleY);
+            int dy2 = y + std::lround((y2 - this->maskY) * scaleY);
+
+            for (size_t col = 0; col < 3; col++) {
+                int x1 = std::max(layX[col], this->maskX);
+                int x2 = std::min(layX[col + 1], this->maskX + this->maskW);
+                if (x2 <= x1) {
+                    continue;
+                }
+
+                float sliceW = (srcX[col + 1] - srcX[col])/static_cast<float>(layX[col + 1] - layX[col]);
+                float u1 = this->originX + srcX[col] + (x1 - layX[col]) * sliceW;
+                float u2 = this->originX + srcX[col] + (x2 - layX[col]) * sliceW;
+                int dx1 = x + std::lround((x1 - this->maskX) * scaleX);
+                int dx2 = x + std::lround((x2 - this->maskX) * scaleX);
+
+                this->renderer->drawTextureRegion(this->data.texture, this->colour_, dx1, dy1, dx2 - dx1, dy2 - dy1, u1, v1, u2 - u1, v2 - v1);
+            }
+        }
+    }
+
     void Drawable::render(const int x, const int y, const unsigned int width, const unsigned int height) {
+        // Skip anything entirely outside of the clipping area
+        if (this->renderer != nullptr && this->renderer->clipped(x, y, width == 0 ? this->width_ : width, height == 0 ? this->height_ : height)) {
+            return;
+        }
+
+        // Fills are solid, so the mask only matters if it hides everything
+        if (this->type_ == Type::Fill) {
+            if (this->maskW > 0 && this->maskH > 0) {
+                this->renderer->drawFilledRect(this->colour_, x, y, width == 0 ? this->width_ : width, height == 0 ? this->height_ : height);
+            }
+            return;
+        }
+
         // Don't draw "nothing" or surfaces
         if (this->type_ != Type::Texture) {
             return;
         }
 
-        this->renderer->drawTexture(this->data.texture, this->colour_, x, y, width == 0 ? this->width_ : width, height == 0 ? this->height_ : height, this->maskX, this->maskY, this->maskW, this->maskH);
+        if (this->nineSlice_) {
+            this->renderNineSlice(x, y, width == 0 ? this->width_ : width, height == 0 ? this->height_ : height);
+            return;
+        }
+
+        this->renderer->drawTexture(this->data.texture, this->colour_, x, y, width == 0 ? this->width_ : width, height == 0 ? this->height_ : height, this->originX + this->maskX, this->originY + this->maskY, this->maskW, this->maskH);
     }
 
     bool Drawable::convertToTexture() {
@@ -77,8 +234,22 @@ namespace Aether {
             return true;
         }
 
+        // Small images can share a texture with others
+        if (this->atlas_ && this->format_ == TextureFormat::Auto) {
+            int x, y;
+            SDL_Texture * page = this->renderer->addToAtlas(this->data.surface, x, y);
+            if (page != nullptr) {
+                this->data.texture = page;
+                this->packed = true;
+                this->originX = x;
+                this->originY = y;
+                this->type_ = Type::Texture;
+                return true;
+            }
+        }
+
         // Attempt conversion and return result
-        this->data.texture = this->renderer->convertSurfaceToTexture(this->data.surface);
+        this->data.texture = this->renderer->convertSurfaceToTexture(this->data.surface, this->format_);
         if (this->data.texture == nullptr) {
             this->type_ = Type::None;
         } else {
@@ -88,6 +259,18 @@ namespace Aether {
         return (this->type_ == Type::Texture);
     }
 
+    void Drawable::setAtlas(const bool atlas) {
+        this->atlas_ = atlas;
+    }
+
+    void Drawable::setFormat(const TextureFormat format) {
+        this->format_ = format;
+    }
+
+    TextureFormat Drawable::format() {
+        return this->format_;
+    }
+
     Drawable::Type Drawable::type() {
         return this->type_;
     }
@@ -100,17 +283,40 @@ namespace Aether {
         return static_cast<int>(this->height_);
     }
 
+    size_t Drawable::surfaceSize() {
+        if (this->type_ != Type::Surface) {
+            return 0;
+        }
+
+        return this->data.surface->pitch * this->data.surface->h;
+    }
+
+    size_t Drawable::textureSize() {
+        if (this->type_ != Type::Texture || this->packed) {
+            return 0;
+        }
+
+        return Renderer::textureBytes(this->data.texture);
+    }
+
     Drawable::~Drawable() {
         switch (this->type_) {
             case Type::None:
+            case Type::Fill:
                 break;
 
             case Type::Surface:
                 this->renderer->destroySurface(this->data.surface, true);
                 break;
 
+            // Textures are destroyed in bulk after the frame is presented, as this may happen
+            // mid-frame or on another thread
             case Type::Texture:
-                this->renderer->destroyTexture(this->data.texture, true);
+                if (this->packed) {
+                    this->renderer->releaseAtlasImage(this->data.texture, this->originX, this->originY);
+                } else {
+                    this->renderer->releaseTexture(this->data.texture);
+                }
                 break;
         }
     }
@@ -1,4 +1,6 @@
 #include "Aether/types/ImageData.hpp"
+#include <algorithm>
+#include <cstdlib>
 
 namespace Aether {
     ImageData::ImageData() {
@@ -85,4 +87,22 @@ namespace Aether {
     std::vector<Colour> ImageData::toColourVector() const {
         return this->pixels_;
     }
+
+    size_t ImageData::countDifferences(const ImageData & other, const uint8_t tolerance) const {
+        // Images of different sizes don't match anywhere
+        if (this->width_ != other.width_ || this->height_ != other.height_ || this->pixels_.size() != other.pixels_.size()) {
+            return std::max(this->pixels_.size(), other.pixels_.size());
+        }
+
+        size_t count = 0;
+        for (size_t idx = 0; idx < this->pixels_.size(); idx++) {
+            const Colour & a = this->pixels_[idx];
+            const Colour & b = other.pixels_[idx];
+            if (std::abs(a.r() - b.r()) > tolerance || std::abs(a.g() - b.g()) > tolerance || std::abs(a.b() - b.b()) > tolerance || std::abs(a.a() - b.a()) > tolerance) {
+                count++;
+            }
+        }
+
+        return count;
+    }
 };
\ No newline at end of file
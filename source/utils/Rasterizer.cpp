@@ -0,0 +1,134 @@
+#include "Aether/utils/Rasterizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Aether::Utils::Rasterizer {
+    // Describes a box with (elliptical) rounded corners, centred on the origin
+    struct Shape {
+        float hx;       // Half width
+        float hy;       // Half height
+        float bx;       // Half width of box formed by corner centres
+        float by;       // Half height of box formed by corner centres
+        float rx;       // Horizontal corner radius
+        float ry;       // Vertical corner radius
+        bool valid;     // Whether the shape has any area
+    };
+
+    // Forms a shape covering the given area, shrunk on all sides by the inset
+    static Shape makeShape(const size_t width, const size_t height, const float rx, const float ry, const float inset) {
+        Shape s;
+        s.hx = width/2.0f - inset;
+        s.hy = height/2.0f - inset;
+        s.rx = std::max(0.0f, std::min(rx, width/2.0f) - inset);
+        s.ry = std::max(0.0f, std::min(ry, height/2.0f) - inset);
+        s.rx = std::min(s.rx, std::max(s.hx, 0.0f));
+        s.ry = std::min(s.ry, std::max(s.hy, 0.0f));
+        s.bx = s.hx - s.rx;
+        s.by = s.hy - s.ry;
+        s.valid = (s.hx > 0.0f && s.hy > 0.0f);
+        return s;
+    }
+
+    // Returns the (approximate) signed distance from the shape's edge to the given point,
+    // which is expected to have been folded into the positive quadrant
+    static float distance(const Shape & s, const float px, const float py) {
+        float ax = px - s.bx;
+        float ay = py - s.by;
+
+        // Inside a straight section the nearest edge is axis-aligned
+        if (ax <= 0.0f || ay <= 0.0f) {
+            return std::max(ax - s.rx, ay - s.ry);
+        }
+
+        // Circular corners (or no corner at all) are exact
+        if (s.rx <= 0.0f || s.ry <= 0.0f || s.rx == s.ry) {
+            return std::sqrt(ax*ax + ay*ay) - std::min(s.rx, s.ry);
+        }
+
+        // Otherwise approximate the distance to the ellipse using it's gradient
+        float k0 = std::sqrt((ax*ax)/(s.rx*s.rx) + (ay*ay)/(s.ry*s.ry));
+        float k1 = std::sqrt((ax*ax)/(s.rx*s.rx*s.rx*s.rx) + (ay*ay)/(s.ry*s.ry*s.ry*s.ry));
+        return k0 * (k0 - 1.0f)/k1;
+    }
+
+    // Converts a distance into the fraction of the pixel covered by the shape
+    static float coverage(const float d) {
+        return std::min(1.0f, std::max(0.0f, 0.5f - d));
+    }
+
+    // Writes a white pixel with the given coverage
+    static void setPixel(uint8_t * row, const size_t x, const float cov) {
+        uint8_t * px = row + 4*x;
+        px[0] = 255;
+        px[1] = 255;
+        px[2] = 255;
+        px[3] = static_cast<uint8_t>(cov * 255.0f + 0.5f);
+    }
+
+    void clear(uint8_t * pixels, const size_t width, const size_t height, const size_t pitch) {
+        // Form the pixel from bytes so it's independent of endianness
+        const uint8_t bytes[4] = {255, 255, 255, 0};
+        uint32_t transparent;
+        std::memcpy(&transparent, bytes, sizeof(transparent));
+
+        for (size_t y = 0; y < height; y++) {
+            uint32_t * row = reinterpret_cast<uint32_t *>(pixels + y*pitch);
+            std::fill_n(row, width, transparent);
+        }
+    }
+
+    void drawRoundRect(uint8_t * pixels, const size_t width, const size_t height, const size_t pitch, const float rx, const float ry, const float thick) {
+        Shape outer = makeShape(width, height, rx, ry, 0.0f);
+        if (!outer.valid) {
+            return;
+        }
+        Shape inner = makeShape(width, height, rx, ry, thick);
+        bool hasInner = (thick > 0.0f && inner.valid);
+        bool filled = (thick <= 0.0f);
+
+        // The shape is symmetric, so only the top-left quadrant is evaluated and then mirrored
+        size_t midX = (width + 1)/2;
+        size_t midY = (height + 1)/2;
+        for (size_t y = 0; y < midY; y++) {
+            uint8_t * row = pixels + y*pitch;
+            float py = std::fabs(y + 0.5f - height/2.0f);
+
+            // Whether this row passes through the hole of an outline
+            bool crossesInner = (hasInner && py - inner.hy < 0.5f);
+
+            for (size_t x = 0; x < midX; x++) {
+                float px = std::fabs(x + 0.5f - width/2.0f);
+                float dOut = distance(outer, px, py);
+
+                // Once fully inside the shape (and not near the hole) the rest of the
+                // span up to it's mirrored edge is solid, so fill it in one go
+                if (dOut <= -0.5f && (filled || !crossesInner)) {
+                    std::memset(row + 4*x, 0xFF, 4*(width - 2*x));
+                    break;
+                }
+
+                float cov = coverage(dOut);
+                if (crossesInner) {
+                    float dIn = distance(inner, px, py);
+
+                    // Fully inside the hole, which stays transparent up to the mirrored edge
+                    if (dIn <= -0.5f) {
+                        break;
+                    }
+                    cov = std::max(0.0f, cov - coverage(dIn));
+                }
+
+                if (cov > 0.0f) {
+                    setPixel(row, x, cov);
+                    setPixel(row, width - 1 - x, cov);
+                }
+            }
+
+            // Mirror onto the bottom half
+            if (height - 1 - y != y) {
+                std::memcpy(pixels + (height - 1 - y)*pitch, row, 4*width);
+            }
+        }
+    }
+};
@@ -0,0 +1,72 @@
+#include "Aether/types/ImageData.hpp"
+#include "Test.hpp"
+
+using Aether::Colour;
+using Aether::ImageData;
+
+// Forms an RGBA image filled with a single colour
+static ImageData solidImage(const size_t width, const size_t height, const Colour & col) {
+    return ImageData(std::vector<Colour>(width * height, col), width, height, 4);
+}
+
+static void testSameSize() {
+    ImageData a = solidImage(4, 3, Colour(10, 20, 30, 255));
+    ImageData b = solidImage(4, 3, Colour(10, 20, 30, 255));
+    CHECK(a.countDifferences(b) == 0);
+    CHECK(a.countDifferences(a) == 0);
+
+    // Every pixel differs in one channel
+    ImageData c = solidImage(4, 3, Colour(10, 20, 31, 255));
+    CHECK(a.countDifferences(c) == 12);
+    CHECK(c.countDifferences(a) == 12);
+
+    // Only changed pixels are counted
+    std::vector<Colour> pixels = a.toColourVector();
+    pixels[0] = Colour(0, 0, 0, 0);
+    pixels[11] = Colour(10, 20, 30, 254);
+    ImageData d(pixels, 4, 3, 4);
+    CHECK(a.countDifferences(d) == 2);
+}
+
+static void testSizeMismatch() {
+    // The larger image's pixel count is returned, whichever way round they're compared
+    ImageData a = solidImage(4, 3, Colour(0, 0, 0, 255));
+    ImageData b = solidImage(5, 3, Colour(0, 0, 0, 255));
+    CHECK(a.countDifferences(b) == 15);
+    CHECK(b.countDifferences(a) == 15);
+
+    // Same pixel count but different dimensions
+    ImageData c = solidImage(3, 4, Colour(0, 0, 0, 255));
+    CHECK(a.countDifferences(c) == 12);
+
+    // An invalid image matches nothing
+    CHECK(a.countDifferences(ImageData()) == 12);
+    CHECK(ImageData().countDifferences(ImageData()) == 0);
+}
+
+static void testToleranceBoundary() {
+    ImageData a = solidImage(2, 2, Colour(100, 100, 100, 100));
+
+    // A difference equal to the tolerance is allowed, one more is not
+    ImageData b = solidImage(2, 2, Colour(105, 100, 100, 100));
+    CHECK(a.countDifferences(b, 4) == 4);
+    CHECK(a.countDifferences(b, 5) == 0);
+    CHECK(a.countDifferences(b, 6) == 0);
+
+    // Differences below zero are treated the same, in any channel
+    ImageData c = solidImage(2, 2, Colour(100, 100, 100, 95));
+    CHECK(a.countDifferences(c, 4) == 4);
+    CHECK(a.countDifferences(c, 5) == 0);
+
+    // The largest tolerance accepts anything
+    ImageData d = solidImage(2, 2, Colour(255, 0, 255, 0));
+    CHECK(solidImage(2, 2, Colour(0, 255, 0, 255)).countDifferences(d, 255) == 0);
+    CHECK(solidImage(2, 2, Colour(0, 255, 0, 255)).countDifferences(d, 254) == 4);
+}
+
+int main() {
+    testSameSize();
+    testSizeMismatch();
+    testToleranceBoundary();
+    return Test::finish("ImageData");
+}
@@ -0,0 +1,177 @@
+#include "Aether/utils/Rasterizer.hpp"
+#include "Test.hpp"
+#include <vector>
+
+namespace Rasterizer = Aether::Utils::Rasterizer;
+
+// Padding value placed after each row, which must never be written
+static constexpr uint8_t padding = 0xAB;
+static constexpr size_t paddingBytes = 8;
+
+// A cleared RGBA32 buffer with padding at the end of each row
+struct Buffer {
+    size_t width;
+    size_t height;
+    size_t pitch;
+    std::vector<uint8_t> pixels;
+
+    Buffer(const size_t w, const size_t h) {
+        this->width = w;
+        this->height = h;
+        this->pitch = 4*w + paddingBytes;
+        this->pixels = std::vector<uint8_t>(this->pitch * h, padding);
+        Rasterizer::clear(this->pixels.data(), w, h, this->pitch);
+    }
+
+    void draw(const float rx, const float ry, const float thick) {
+        Rasterizer::drawRoundRect(this->pixels.data(), this->width, this->height, this->pitch, rx, ry, thick);
+    }
+
+    uint8_t alpha(const size_t x, const size_t y) const {
+        return this->pixels[y*this->pitch + 4*x + 3];
+    }
+
+    // Every pixel is white and the padding is untouched
+    bool intact() const {
+        for (size_t y = 0; y < this->height; y++) {
+            const uint8_t * row = this->pixels.data() + y*this->pitch;
+            for (size_t x = 0; x < this->width; x++) {
+                if (row[4*x] != 255 || row[4*x + 1] != 255 || row[4*x + 2] != 255) {
+                    return false;
+                }
+            }
+            for (size_t i = 4*this->width; i < this->pitch; i++) {
+                if (row[i] != padding) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // The shape is mirrored in both axes
+    bool symmetric() const {
+        for (size_t y = 0; y < this->height; y++) {
+            for (size_t x = 0; x < this->width; x++) {
+                if (this->alpha(x, y) != this->alpha(this->width - 1 - x, y) || this->alpha(x, y) != this->alpha(x, this->height - 1 - y)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+static void testClear() {
+    Buffer buf(7, 5);
+    CHECK(buf.intact());
+    CHECK(buf.alpha(0, 0) == 0);
+    CHECK(buf.alpha(6, 4) == 0);
+}
+
+static void testFilledRect() {
+    Buffer buf(9, 6);
+    buf.draw(0, 0, 0);
+    CHECK(buf.intact());
+
+    bool solid = true;
+    for (size_t y = 0; y < buf.height; y++) {
+        for (size_t x = 0; x < buf.width; x++) {
+            solid = solid && (buf.alpha(x, y) == 255);
+        }
+    }
+    CHECK(solid);
+}
+
+static void testFilledRoundRect() {
+    Buffer buf(20, 20);
+    buf.draw(5, 5, 0);
+    CHECK(buf.intact());
+    CHECK(buf.symmetric());
+
+    // Corners are cut away, while the edges between them are solid
+    CHECK(buf.alpha(0, 0) == 0);
+    CHECK(buf.alpha(10, 10) == 255);
+    CHECK(buf.alpha(0, 10) == 255);
+    CHECK(buf.alpha(10, 0) == 255);
+
+    // The curve is anti-aliased
+    bool partial = false;
+    for (size_t x = 0; x < 5; x++) {
+        partial = partial || (buf.alpha(x, 1) > 0 && buf.alpha(x, 1) < 255);
+    }
+    CHECK(partial);
+}
+
+static void testOutlinedRoundRect() {
+    Buffer buf(20, 20);
+    buf.draw(5, 5, 2);
+    CHECK(buf.intact());
+    CHECK(buf.symmetric());
+
+    // Only a border of the given thickness is drawn
+    CHECK(buf.alpha(0, 10) == 255);
+    CHECK(buf.alpha(1, 10) == 255);
+    CHECK(buf.alpha(2, 10) == 0);
+    CHECK(buf.alpha(10, 10) == 0);
+    CHECK(buf.alpha(0, 0) == 0);
+
+    // A border thicker than the shape fills it
+    Buffer thick(10, 10);
+    thick.draw(3, 3, 6);
+    CHECK(thick.alpha(5, 5) == 255);
+}
+
+static void testFilledEllipse() {
+    Buffer buf(30, 20);
+    buf.draw(15, 10, 0);
+    CHECK(buf.intact());
+    CHECK(buf.symmetric());
+
+    // Solid in the middle, touching each edge, and empty in the corners
+    CHECK(buf.alpha(15, 10) == 255);
+    CHECK(buf.alpha(0, 10) > 0);
+    CHECK(buf.alpha(15, 0) > 0);
+    CHECK(buf.alpha(0, 0) == 0);
+    CHECK(buf.alpha(1, 1) == 0);
+
+    // Coverage never drops moving in from the edge
+    bool increasing = true;
+    for (size_t x = 1; x < 15; x++) {
+        increasing = increasing && (buf.alpha(x, 10) >= buf.alpha(x - 1, 10));
+    }
+    CHECK(increasing);
+}
+
+static void testOutlinedEllipse() {
+    Buffer buf(30, 20);
+    buf.draw(15, 10, 3);
+    CHECK(buf.intact());
+    CHECK(buf.symmetric());
+
+    CHECK(buf.alpha(15, 10) == 0);
+    CHECK(buf.alpha(0, 10) > 0);
+    CHECK(buf.alpha(1, 10) == 255);
+    CHECK(buf.alpha(15, 1) == 255);
+    CHECK(buf.alpha(0, 0) == 0);
+}
+
+static void testEmpty() {
+    // Nothing is written when there's no area
+    Buffer buf(4, 4);
+    Rasterizer::drawRoundRect(buf.pixels.data(), 0, 4, buf.pitch, 0, 0, 0);
+    Rasterizer::drawRoundRect(buf.pixels.data(), 4, 0, buf.pitch, 0, 0, 0);
+    CHECK(buf.intact());
+    CHECK(buf.alpha(1, 1) == 0);
+}
+
+int main() {
+    testClear();
+    testFilledRect();
+    testFilledRoundRect();
+    testOutlinedRoundRect();
+    testFilledEllipse();
+    testOutlinedEllipse();
+    testEmpty();
+    return Test::finish("Rasterizer");
+}
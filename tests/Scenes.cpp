@@ -0,0 +1,246 @@
+#include "Aether/Aether.hpp"
+#include "Aether/horizon/input/Spinner.hpp"
+#include "Aether/horizon/list/List.hpp"
+#include "Aether/horizon/list/ListButton.hpp"
+#include "Test.hpp"
+#include <cstdlib>
+#include <ctime>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+// Size of the (headless) window each scene is drawn in
+static constexpr unsigned int windowWidth = 1280;
+static constexpr unsigned int windowHeight = 720;
+
+// Frames each scene runs for before it's compared, after which it's run until two frames
+// in a row match (so async textures have been uploaded), giving up at the maximum
+static constexpr size_t minFrames = 30;
+static constexpr size_t maxFrames = 600;
+
+// Largest difference allowed in any channel, absorbing rounding differences between drivers
+static constexpr uint8_t tolerance = 8;
+
+// Fraction of pixels which may differ by more than the tolerance (e.g. along anti-aliased edges)
+static constexpr double maxDifferent = 0.002;
+
+// Directory holding the golden image for each scene
+static constexpr const char * goldenDir = "tests/golden";
+
+// Font used for all text (override with AETHER_TEST_FONT), as the golden images were drawn with it
+static constexpr const char * defaultFont = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+
+// Date shown by the DateTime scene (must outlive the overlay)
+static struct tm sceneDate = {0, 45, 13, 24, 11, 120};
+
+// A screen (plus any overlays shown over it) to draw and compare
+struct Scene {
+    std::string name;
+    std::function<void(Aether::Screen *, std::vector<Aether::Overlay *> &)> build;
+};
+
+// Loads a PNG into an RGBA image, which is invalid if it couldn't be read
+static Aether::ImageData loadImage(const std::string & path) {
+    SDL_Surface * loaded = IMG_Load(path.c_str());
+    if (loaded == nullptr) {
+        return Aether::ImageData();
+    }
+
+    SDL_Surface * surf = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(loaded);
+    if (surf == nullptr) {
+        return Aether::ImageData();
+    }
+
+    std::vector<uint8_t> pixels(4 * surf->w * surf->h);
+    SDL_LockSurface(surf);
+    for (int y = 0; y < surf->h; y++) {
+        const uint8_t * row = static_cast<uint8_t *>(surf->pixels) + y*surf->pitch;
+        std::copy(row, row + 4*surf->w, pixels.begin() + 4*y*surf->w);
+    }
+    SDL_UnlockSurface(surf);
+
+    Aether::ImageData image(pixels, surf->w, surf->h, 4);
+    SDL_FreeSurface(surf);
+    return image;
+}
+
+// Writes an RGBA image to a PNG
+static bool saveImage(const Aether::ImageData & image, const std::string & path) {
+    std::vector<uint8_t> pixels = image.toByteVector();
+    SDL_Surface * surf = SDL_CreateRGBSurfaceWithFormatFrom(pixels.data(), image.width(), image.height(), 32, 4 * image.width(), SDL_PIXELFORMAT_RGBA32);
+    if (surf == nullptr) {
+        return false;
+    }
+
+    bool ok = (IMG_SavePNG(surf, path.c_str()) == 0);
+    SDL_FreeSurface(surf);
+    return ok;
+}
+
+static std::vector<Scene> scenes() {
+    return {
+        {"list", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            Aether::List * list = new Aether::List(340, 60, 600, 600);
+            list->addElement(new Aether::ListHeading("Heading"));
+            list->addElement(new Aether::ListButton("Button", nullptr));
+            list->addElement(new Aether::ListOption("Option", "Value", nullptr));
+            list->addElement(new Aether::ListSeparator());
+            list->addElement(new Aether::ListComment("A comment which is long enough that it has to be wrapped onto a second line."));
+            for (int i = 0; i < 8; i++) {
+                list->addElement(new Aether::ListOption("Item " + std::to_string(i), std::to_string(i * 10) + "%", nullptr));
+            }
+            screen->addElement(list);
+        }},
+
+        {"popuplist", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            Aether::PopupList * popup = new Aether::PopupList("Sort By");
+            popup->addEntry("Name", nullptr, true);
+            popup->addEntry("Date Added", nullptr);
+            popup->addEntry("Size", nullptr);
+            overlays.push_back(popup);
+        }},
+
+        {"datetime", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            overlays.push_back(new Aether::DateTime("Set Date and Time", sceneDate, Aether::DTFlag::DateTime));
+        }},
+
+        {"messagebox", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            Aether::MessageBox * msg = new Aether::MessageBox();
+            msg->addLeftButton("Cancel", nullptr);
+            msg->addRightButton("OK", nullptr);
+            msg->setBodySize(600, 200);
+
+            int w, h;
+            msg->getBodySize(&w, &h);
+            Aether::Element * body = new Aether::Element(0, 0, w, h);
+            body->addElement(new Aether::TextBlock(40, 40, "Are you sure you want to delete this item? This can't be undone.", 24, w - 80));
+            msg->setBody(body);
+            overlays.push_back(msg);
+        }},
+
+        {"spinner", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            const int values[3] = {7, 42, 1999};
+            for (int i = 0; i < 3; i++) {
+                Aether::Spinner * spinner = new Aether::Spinner(400 + 180*i, 300, 120);
+                spinner->setMin(0);
+                spinner->setMax(9999);
+                spinner->setDigits(i == 2 ? 4 : 2);
+                spinner->setValue(values[i]);
+                spinner->setLabel("Value " + std::to_string(i + 1));
+                screen->addElement(spinner);
+            }
+        }},
+
+        {"progress", [](Aether::Screen * screen, std::vector<Aether::Overlay *> & overlays) {
+            const float values[4] = {0.0f, 33.3f, 75.0f, 100.0f};
+            for (int i = 0; i < 4; i++) {
+                Aether::ProgressBar * bar = new Aether::ProgressBar(240, 150 + 80*i, 350);
+                bar->setValue(values[i]);
+                screen->addElement(bar);
+
+                Aether::RoundProgressBar * round = new Aether::RoundProgressBar(690, 150 + 80*i, 350);
+                round->setValue(values[i]);
+                screen->addElement(round);
+            }
+        }}
+    };
+}
+
+// Draws the scene until it settles, then compares it against it's golden image (skipping the
+// comparison if there's no golden image, unless strict)
+static void runScene(Aether::Window & window, const Scene & scene, const bool update, const bool strict) {
+    Aether::Screen * screen = new Aether::Screen();
+    std::vector<Aether::Overlay *> overlays;
+    scene.build(screen, overlays);
+    window.showScreen(screen);
+    for (Aether::Overlay * ovl : overlays) {
+        window.addOverlay(ovl);
+    }
+
+    Aether::ImageData frame;
+    Aether::ImageData previous;
+    size_t frames = 0;
+    while (frames < maxFrames) {
+        window.loop();
+        frames++;
+
+        frame = window.readFrame();
+        if (frames >= minFrames && frame.valid() && frame.countDifferences(previous) == 0) {
+            break;
+        }
+        previous = frame;
+    }
+    Aether::FrameStats stats = window.frameStats();
+
+    // Compare (or replace) the golden image
+    std::string path = std::string(goldenDir) + "/" + scene.name + ".png";
+    bool passed = false;
+    bool skipped = false;
+    std::string result;
+    if (!frame.valid()) {
+        result = "couldn't read frame";
+
+    } else if (update) {
+        passed = saveImage(frame, path);
+        result = (passed ? "golden image written" : "couldn't write " + path);
+
+    } else {
+        Aether::ImageData golden = loadImage(path);
+        if (!golden.valid()) {
+            skipped = !strict;
+            result = "missing " + path + " (run with AETHER_UPDATE_GOLDEN=1 to create it)";
+        } else {
+            size_t different = frame.countDifferences(golden, tolerance);
+            passed = (different <= maxDifferent * frame.width() * frame.height());
+            result = std::to_string(different) + " pixels differ";
+            if (!passed) {
+                saveImage(frame, "build/tests/" + scene.name + ".actual.png");
+                result += ", wrote build/tests/" + scene.name + ".actual.png";
+            }
+        }
+    }
+    if (frames == maxFrames) {
+        result += ", didn't settle";
+    }
+
+    std::printf("  %-10s %s (%s)\n", scene.name.c_str(), (skipped ? "SKIP" : (passed ? "PASS" : "FAIL")), result.c_str());
+    std::printf("  %-10s %zu frames, %.2f ms, %zu commands, %zu batches, %zu bytes uploaded, %u textures, %lu KB\n", "", frames, stats.frameTime, stats.drawCommands, stats.batches, stats.uploadedBytes, stats.textureCount, stats.memoryUsage/1024);
+    CHECK(passed || skipped);
+
+    // Let the overlays close before the screen goes
+    for (Aether::Overlay * ovl : overlays) {
+        ovl->close();
+    }
+    window.loop();
+    for (Aether::Overlay * ovl : overlays) {
+        delete ovl;
+    }
+    window.removeScreen();
+    delete screen;
+}
+
+int main() {
+    const char * font = std::getenv("AETHER_TEST_FONT");
+    bool update = (std::getenv("AETHER_UPDATE_GOLDEN") != nullptr);
+    bool strict = (std::getenv("AETHER_STRICT_GOLDEN") != nullptr);
+
+    Aether::Window window("Aether Tests", windowWidth, windowHeight, [](const std::string message, const bool important) {
+        if (important) {
+            std::printf("  [Aether] %s\n", message.c_str());
+        }
+    }, Aether::PresentMode::Uncapped, "", true);
+
+    // Keep everything that changes over time fixed, so every run draws the same frames
+    window.setFont(font != nullptr ? font : defaultFont);
+    window.setBackgroundColour(Aether::Theme::Dark.bg);
+    window.setHighlightBackground(Aether::Theme::Dark.highlightBG);
+    window.setHighlightOverlay(Aether::Theme::Dark.selected);
+    window.setHighlightAnimation([](const uint32_t t) {
+        return Aether::Theme::Dark.highlightFunc(0);
+    });
+
+    for (const Scene & scene : scenes()) {
+        runScene(window, scene, update, strict);
+    }
+    return Test::finish("Scenes");
+}
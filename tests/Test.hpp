@@ -0,0 +1,43 @@
+#ifndef AETHER_TESTS_TEST_HPP
+#define AETHER_TESTS_TEST_HPP
+
+#include <cstdio>
+
+// Minimal helpers shared by the test programs. Each program is built and run on its own
+// by `make test`, which fails if the program returns non-zero.
+namespace Test {
+    /** @brief Number of checks which have failed so far */
+    inline int failures = 0;
+
+    /**
+     * @brief Records the result of a check, printing it if it failed.
+     *
+     * @param passed Whether the check passed
+     * @param expr Text of the checked expression
+     * @param file File the check is in
+     * @param line Line the check is on
+     */
+    inline void check(const bool passed, const char * expr, const char * file, const int line) {
+        if (!passed) {
+            std::printf("  FAILED: %s (%s:%d)\n", expr, file, line);
+            failures++;
+        }
+    }
+
+    /**
+     * @brief Prints a summary of the checks, returning the program's exit code.
+     *
+     * @param name Name of the test program
+     *
+     * @return 0 if every check passed, 1 otherwise
+     */
+    inline int finish(const char * name) {
+        std::printf("%s: %s\n", name, (failures == 0 ? "passed" : "FAILED"));
+        return (failures == 0 ? 0 : 1);
+    }
+};
+
+// Checks the given condition is true, carrying on with the test either way
+#define CHECK(expr) Test::check((expr), #expr, __FILE__, __LINE__)
+
+#endif